@@ -0,0 +1,119 @@
+#pragma once
+#include "raylib.h"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Quetz_LabEDC
+{
+	class GameObject;
+	class IAIAgent;
+}
+
+//nivel de detalle de la IA, del mas caro al mas barato
+enum EAITier : uint8_t
+{
+	AI_TIER_NEAR,   //visible: cada tick
+	AI_TIER_MID,    //cerca de la pantalla: cada midInterval ticks
+	AI_TIER_FAR,    //lejos: cada farInterval ticks
+	AI_TIER_ASLEEP, //no corre hasta que lo despierte la distancia o un evento
+	AI_TIER_COUNT
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// Planificador de IA por nivel de detalle.
+// Los agentes se registran una vez (Enemy, sideKick) y su tick(dt) ya no
+// corre en el update de cada frame: segun su distancia a la vista van en
+// un nivel que decide cada cuanto corren. Los de nivel medio y lejano se
+// reparten por fase entre los ticks, y la reclasificacion tambien se hace
+// por partes, asi el costo por frame queda parejo.
+// El tiempo se acumula mientras no les toca, para que se muevan igual.
+//////////////////////////////////////////////////////////////////////////////
+class AIScheduler
+{
+public:
+	static constexpr int DEFAULT_MID_INTERVAL = 4;
+	static constexpr int DEFAULT_FAR_INTERVAL = 16;
+	//cada agente se reclasifica al menos cada tantos ticks
+	static constexpr int CLASSIFY_INTERVAL = 8;
+	//segundos despierto despues de un Wake
+	static constexpr float WAKE_SECONDS = 2.0f;
+	//hasta donde se oye un impacto (px)
+	static constexpr float NOISE_RADIUS = 300.0f;
+
+	static AIScheduler& getInstance()
+	{
+		if (!instance)
+		{
+			instance = new AIScheduler();
+		}
+		return *instance;
+	}
+
+	void Register(Quetz_LabEDC::GameObject* obj, Quetz_LabEDC::IAIAgent* agent);
+	void Unregister(Quetz_LabEDC::GameObject* obj);
+	//evento (dano, ruido...): lo pone en el nivel cercano un rato
+	void Wake(Quetz_LabEDC::GameObject* obj);
+	//despierta a todos los agentes a menos de radius de un evento (impacto)
+	void WakeAround(Vector2 position, float radius = NOISE_RADIUS);
+
+	//view: rectangulo visible; focus: punto de interes (el jugador)
+	void Update(float deltaTime, Rectangle view, Vector2 focus);
+
+	//distancias a la vista para cada nivel
+	void SetRadii(float mid, float far) { midRadius = mid; farRadius = far; }
+	//cada cuantos ticks corren los niveles medio y lejano
+	void SetIntervals(int mid, int far)
+	{
+		midInterval = mid < 1 ? 1 : mid;
+		farInterval = far < 1 ? 1 : far;
+	}
+	int GetMidInterval() const { return midInterval; }
+	int GetFarInterval() const { return farInterval; }
+	//tope de ticks de nivel medio/lejano por frame (0 = sin tope); los cercanos siempre corren
+	void SetMaxTicksPerFrame(int maxTicks) { maxTicksPerFrame = maxTicks; }
+
+	size_t GetAgentCount() const { return agents.size(); }
+	int GetTierCount(EAITier tier) const { return tierCounts[tier]; }
+	int GetTicksLastFrame() const { return ticksLastFrame; }
+	//ticks que se pasaron al siguiente frame por el tope
+	int GetDeferredLastFrame() const { return deferredLastFrame; }
+	EAITier GetTier(Quetz_LabEDC::GameObject* obj) const;
+
+private:
+	static AIScheduler* instance;
+
+	struct Agent
+	{
+		Quetz_LabEDC::GameObject* obj;
+		Quetz_LabEDC::IAIAgent* ai;
+		float pendingTime; //tiempo acumulado sin tick
+		float awakeTime;   //restante de un Wake
+		uint8_t tier;
+		uint8_t phase;     //reparte los ticks de nivel medio/lejano (modulo el intervalo)
+		bool due;          //le toco pero no cupo en el tope
+	};
+
+	std::vector<Agent> agents;
+	std::unordered_map<Quetz_LabEDC::GameObject*, size_t> indexOf;
+	std::vector<Quetz_LabEDC::GameObject*> runScratch; //se reutiliza entre ticks
+	size_t classifyCursor = 0;
+	uint32_t tickCount = 0;
+	float midRadius = 400.0f;
+	float farRadius = 1200.0f;
+	int maxTicksPerFrame = 0;
+	int midInterval = DEFAULT_MID_INTERVAL;
+	int farInterval = DEFAULT_FAR_INTERVAL;
+
+	int tierCounts[AI_TIER_COUNT] = {};
+	int ticksLastFrame = 0;
+	int deferredLastFrame = 0;
+
+	AIScheduler() = default;
+	AIScheduler(const AIScheduler&) = delete;
+	AIScheduler& operator=(const AIScheduler&) = delete;
+
+	EAITier Classify(const Agent& agent, Rectangle view, Vector2 focus) const;
+	void SetTier(Agent& agent, EAITier tier);
+};
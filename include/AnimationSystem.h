@@ -0,0 +1,121 @@
+#pragma once
+#include "raylib.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+enum EAnimLoop : uint8_t
+{
+	ANIM_LOOP,    //vuelve al primer frame
+	ANIM_ONCE,    //se queda en el ultimo frame y marca terminado
+	ANIM_PINGPONG //va y regresa
+};
+
+//definicion compartida de una animacion; los frames viven en el arreglo del sistema
+struct AnimationClip
+{
+	std::string name;
+	Texture2D sheet;
+	uint32_t firstFrame; //indice en frameRects / frameDurations
+	uint16_t frameCount;
+	EAnimLoop loop;
+};
+
+using AnimatorId = uint32_t;
+static constexpr AnimatorId INVALID_ANIMATOR = 0xFFFFFFFFu;
+
+//////////////////////////////////////////////////////////////////////////////
+// Sistema de animacion por tiempo.
+// Los clips (hoja, rectangulos, duraciones y modo de repeticion) se
+// registran una vez y se comparten. Cada animador es un registro chico en un
+// arreglo compacto; Step(dt) los avanza a todos en un solo ciclo, asi la
+// velocidad de la animacion ya no depende de los FPS.
+// Los ids de animador son estables: una tabla los traduce a su posicion.
+//////////////////////////////////////////////////////////////////////////////
+class AnimationSystem
+{
+public:
+	static AnimationSystem& getInstance()
+	{
+		if (!instance)
+		{
+			instance = new AnimationSystem();
+		}
+		return *instance;
+	}
+
+	//registra un clip (o regresa el que ya tiene ese nombre)
+	uint16_t AddClip(const std::string& name, Texture2D sheet, const std::vector<Rectangle>& frames,
+		const std::vector<float>& durations, EAnimLoop loop);
+	//clip de una fila de la hoja con frames del mismo tamano y duracion
+	uint16_t AddGridClip(const std::string& name, Texture2D sheet, int row, int frameCount,
+		float frameWidth, float frameHeight, float frameDuration, EAnimLoop loop = ANIM_LOOP);
+	//-1 si no existe
+	int FindClip(const std::string& name) const;
+	const AnimationClip& GetClip(uint16_t clip) const { return clips[clip]; }
+
+	AnimatorId Create(uint16_t clip);
+	void Destroy(AnimatorId animator);
+
+	//cambia de clip; si ya es el mismo solo reinicia cuando se pide
+	void Play(AnimatorId animator, uint16_t clip, bool restart = false);
+	void SetSpeed(AnimatorId animator, float speed);
+	void SetPaused(AnimatorId animator, bool paused);
+	bool IsFinished(AnimatorId animator) const;
+
+	//avanza todos los animadores
+	void Step(float deltaTime);
+	//nivel de detalle: avanzar cada tantos ticks con el tiempo acumulado
+	void SetStepInterval(int ticks) { stepInterval = ticks < 1 ? 1 : ticks; }
+	int GetStepInterval() const { return stepInterval; }
+
+	int GetFrame(AnimatorId animator) const;
+	Rectangle GetFrameRect(AnimatorId animator) const;
+	Texture2D GetSheet(AnimatorId animator) const;
+	void Draw(AnimatorId animator, Vector2 position, Color tint = WHITE) const;
+
+	size_t GetActiveCount() const { return states.size(); }
+	size_t GetClipCount() const { return clips.size(); }
+
+private:
+	static AnimationSystem* instance;
+
+	enum : uint8_t
+	{
+		STATE_PAUSED = 1,
+		STATE_FINISHED = 2,
+		STATE_REVERSE = 4, //pingpong de regreso
+	};
+
+	//estado por instancia: 16 bytes, todos juntos
+	struct AnimatorState
+	{
+		uint16_t clip;
+		uint16_t frame;
+		float time;  //tiempo acumulado en el frame actual
+		float speed; //multiplicador
+		uint8_t flags;
+	};
+
+	std::vector<AnimationClip> clips;
+	std::unordered_map<std::string, uint16_t> clipsByName;
+	std::vector<Rectangle> frameRects;
+	std::vector<float> frameDurations;
+
+	std::vector<AnimatorState> states;  //compacto
+	std::vector<AnimatorId> owners;     //posicion -> id
+	std::vector<uint32_t> slotOf;       //id -> posicion
+	std::vector<AnimatorId> freeIds;
+
+	int stepInterval = 1;
+	int stepCounter = 0;
+	float pendingTime = 0.0f;
+
+	AnimationSystem() = default;
+	AnimationSystem(const AnimationSystem&) = delete;
+	AnimationSystem& operator=(const AnimationSystem&) = delete;
+
+	AnimatorState* Find(AnimatorId animator);
+	const AnimatorState* Find(AnimatorId animator) const;
+};
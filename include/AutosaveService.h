@@ -0,0 +1,73 @@
+#pragma once
+#include "SaveData.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+//////////////////////////////////////////////////////////////////////////////
+// Guardado en segundo plano.
+// El hilo principal solo copia el estado (CaptureWorld) en un limite de tick
+// y lo entrega; codificar, comprimir y escribir pasa en un hilo de trabajo.
+// Las copias esperan en fila por orden de llegada; si llega otra para un
+// espacio que aun no se escribe, reemplaza solo a esa (nunca a la de otro
+// espacio, asi un autoguardado no se come un guardado manual).
+//////////////////////////////////////////////////////////////////////////////
+class AutosaveService
+{
+public:
+	static constexpr int AUTOSAVE_SLOT = 9;
+	static constexpr float DEFAULT_INTERVAL = 60.0f; //segundos
+
+	static AutosaveService& getInstance()
+	{
+		if (!instance)
+		{
+			instance = new AutosaveService();
+		}
+		return *instance;
+	}
+
+	float interval = DEFAULT_INTERVAL;
+
+	//avanza el reloj; true cuando toca tomar una copia para el autoguardado
+	bool Tick(float deltaTime);
+
+	//entrega una copia para escribirla en otro hilo (no bloquea)
+	void Submit(int slot, WorldState&& snapshot);
+
+	//espera a que termine lo pendiente y detiene el hilo (llamar al salir)
+	void Shutdown();
+
+	bool IsBusy() const { return busy; }
+	unsigned int GetSaveCount() const { return saveCount; }
+	unsigned int GetFailCount() const { return failCount; }
+	float GetLastWriteMs() const { return lastWriteMs; }
+
+private:
+	static AutosaveService* instance;
+
+	std::thread worker;
+	std::mutex mutex;
+	std::condition_variable wakeUp;
+	bool running = false;
+	struct PendingSave
+	{
+		int slot;
+		WorldState world;
+	};
+	std::deque<PendingSave> pending;
+
+	float timer = 0.0f;
+	std::atomic<bool> busy{ false };
+	std::atomic<unsigned int> saveCount{ 0 };
+	std::atomic<unsigned int> failCount{ 0 };
+	std::atomic<float> lastWriteMs{ 0.0f };
+
+	AutosaveService() = default;
+	AutosaveService(const AutosaveService&) = delete;
+	AutosaveService& operator=(const AutosaveService&) = delete;
+
+	void Run();
+};
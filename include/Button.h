@@ -9,12 +9,18 @@ public:
     std::string text;
     int fontSize;
     Color color;
+    bool hovered = false;
     std::function<void()> onClick; // Callback para el clic
 
     Button(const std::string& text, int x, int y, int w, int h, Color color, std::function<void()> callback);
     void update() override;
     void draw() override;
 
+    //el despachador de UI avisa del clic, el boton ya no consulta el mouse
+    bool IsInteractive() const override { return true; }
+    void onMouseEnter() override { hovered = true; }
+    void onMouseExit() override { hovered = false; }
+    void onMouseClick() override;
 
-};
 
+};
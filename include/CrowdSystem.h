@@ -0,0 +1,132 @@
+#pragma once
+#include "raylib.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Quetz_LabEDC { class GameObject; }
+
+using CrowdId = uint32_t;
+static constexpr CrowdId INVALID_CROWD_AGENT = 0xFFFFFFFFu;
+
+//cuanto trabajo se hace por agente (sigue al nivel de IA del agente)
+enum ECrowdDetail : uint8_t
+{
+	CROWD_DETAIL_FULL,      //llegada, separacion y alineacion
+	CROWD_DETAIL_GOAL_ONLY, //solo llegada, sin buscar vecinos (lejos de la vista)
+	CROWD_DETAIL_FROZEN,    //no se mueve (dormido); los demas lo esquivan igual
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// Movimiento de multitudes (hordas de enemigos).
+// La IA de cada agente solo decide a donde ir (SetGoal, a su ritmo de
+// AIScheduler); aqui se mueven todos cada tick con tres fuerzas:
+//   llegada:    hacia la meta, frenando dentro de arriveRadius
+//   separacion: lejos de los vecinos mas cercanos que neighborRadius
+//   alineacion: hacia la velocidad promedio de esos vecinos
+// Los vecinos salen de una rejilla uniforme reconstruida cada tick con
+// counting sort (celdas de neighborRadius, 3x3 celdas por consulta) y se
+// cuentan a lo mas MAX_NEIGHBORS por agente, asi el costo por enemigo esta
+// acotado; tambien se revisan a lo mas MAX_CANDIDATES ocupantes de esas
+// celdas, por si la rejilla crecio con una horda muy dispersa. Solo los
+// agentes de detalle completo buscan vecinos: los lejanos van directo a su
+// meta y los dormidos se quedan quietos (ver SetDetail).
+// Los datos van en arreglos compactos (swap-remove, id -> posicion)
+// y el calculo de la direccion se reparte entre hilos de trabajo: cada
+// agente solo lee el estado anterior y escribe su propia velocidad nueva,
+// asi el resultado no depende de cuantos hilos haya.
+//////////////////////////////////////////////////////////////////////////////
+class CrowdSystem
+{
+public:
+	static constexpr int MAX_NEIGHBORS = 16;
+	static constexpr int MAX_CANDIDATES = 64;
+	static constexpr size_t PARALLEL_MIN_AGENTS = 256; //con menos no vale despertar hilos
+	static constexpr unsigned int MAX_WORKERS = 3;
+
+	static CrowdSystem& getInstance()
+	{
+		if (!instance)
+		{
+			instance = new CrowdSystem();
+		}
+		return *instance;
+	}
+
+	//ajustes (px, px/s y pesos relativos a la velocidad maxima)
+	float neighborRadius = 48.0f;
+	float separationWeight = 1.5f;
+	float alignmentWeight = 0.3f;
+	float arriveRadius = 96.0f;
+	float stopRadius = 40.0f;
+	float steerRate = 8.0f; //que tan rapido la velocidad alcanza la deseada (1/s)
+
+	//la posicion se lee y se escribe en obj->position
+	CrowdId Add(Quetz_LabEDC::GameObject* obj);
+	void Remove(CrowdId agent);
+
+	void SetGoal(CrowdId agent, Vector2 goal, float maxSpeed);
+	//sin meta solo se separa de los vecinos y frena
+	void ClearGoal(CrowdId agent);
+	void SetDetail(CrowdId agent, ECrowdDetail detail);
+	Vector2 GetVelocity(CrowdId agent) const;
+	void SetVelocity(CrowdId agent, Vector2 velocity);
+
+	void Update(float deltaTime);
+
+	//detiene los hilos de trabajo (llamar al salir)
+	void Shutdown();
+
+	size_t GetAgentCount() const { return objects.size(); }
+	size_t GetNeighborChecksLastFrame() const { return neighborChecks; }
+	size_t GetWorkerCount() const { return workers.size(); }
+
+private:
+	static CrowdSystem* instance;
+
+	//compactos, por posicion
+	std::vector<Quetz_LabEDC::GameObject*> objects;
+	std::vector<float> posX, posY, velX, velY;
+	std::vector<float> goalX, goalY, maxSpeed;
+	std::vector<uint8_t> hasGoal;
+	std::vector<uint8_t> detail; //ECrowdDetail
+	std::vector<float> newVelX, newVelY;
+	std::vector<CrowdId> owners;   //posicion -> id
+	std::vector<uint32_t> slotOf;  //id -> posicion
+	std::vector<CrowdId> freeIds;
+
+	//rejilla del tick: agentes ordenados por celda
+	float cellSize = 0.0f;
+	float gridMinX = 0.0f, gridMinY = 0.0f;
+	int gridWidth = 0, gridHeight = 0;
+	std::vector<uint32_t> cellStart; //gridWidth * gridHeight + 1
+	std::vector<uint32_t> cellOf;
+	std::vector<uint32_t> cellCursor;
+	std::vector<uint32_t> sorted;
+	size_t neighborChecks = 0;
+
+	//hilos de trabajo: cada uno toma un tramo de agentes por generacion
+	std::vector<std::thread> workers;
+	std::mutex mutex;
+	std::condition_variable wakeUp;
+	std::condition_variable finished;
+	uint64_t generation = 0;
+	size_t pendingWorkers = 0;
+	bool stopping = false;
+	float stepDelta = 0.0f;
+	std::vector<size_t> workerChecks;
+
+	CrowdSystem() = default;
+	CrowdSystem(const CrowdSystem&) = delete;
+	CrowdSystem& operator=(const CrowdSystem&) = delete;
+
+	uint32_t Slot(CrowdId agent) const;
+	void BuildGrid();
+	//direccion nueva de los agentes [begin, end); regresa vecinos revisados
+	size_t Steer(size_t begin, size_t end, float deltaTime);
+	void SteerParallel(float deltaTime);
+	void WorkerLoop(size_t index);
+};
@@ -1,15 +1,26 @@
 #pragma once
 #include "GameObject.h"
+#include "IAIAgent.h"
 #include "Player.h"
+#include "CrowdSystem.h"
 using namespace  Quetz_LabEDC;
 class Enemy :
-    public GameObject
+    public GameObject, public IAIAgent
 {
 public:
     Player* target; // Referencia al jugador
+    CrowdId crowd; // su lugar en la horda (CrowdSystem lo mueve cada tick)
 
     Enemy(Vector2 position, const char* name, Player* player);
-    void update() override;
+    ~Enemy();
+    //la IA (a ritmo del AIScheduler) solo fija la meta; el paso lo da CrowdSystem
+    void tick(float deltaTime) override;
+    //lejos solo va a su meta y dormido no se mueve (ver CrowdSystem)
+    void OnTierChanged(EAITier tier) override;
+    EntityType GetType() const override { return EntityType::Enemy; }
+    //la velocidad de la horda va en record.vector
+    void Capture(EntityRecord& record) const override;
+    void Restore(const EntityRecord& record) override;
 
 
 };
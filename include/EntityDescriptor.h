@@ -0,0 +1,38 @@
+#pragma once
+#include "raylib.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//datos compartidos por todas las instancias de un tipo (flyweight)
+struct EntityDescriptor
+{
+	std::string name;
+	Texture2D texture;
+	float speed;        //velocidad base del tipo
+	float spriteWidth;  //medidas del sprite (por defecto las de la textura)
+	float spriteHeight;
+	bool displayName;   //dibujar la etiqueta con el nombre sobre cada instancia
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// Tabla de descriptores de entidad.
+// Cada combinacion nombre + textura se registra una sola vez; los objetos
+// solo guardan su indice (16 bits), asi mil enemigos comparten un nombre,
+// una textura y sus estadisticas base en lugar de copiarlos.
+//////////////////////////////////////////////////////////////////////////////
+class EntityDescriptors
+{
+public:
+	//indice del descriptor con ese nombre y textura (lo crea si no existe)
+	static uint16_t Intern(const std::string& name, Texture2D texture);
+	static const EntityDescriptor& Get(uint16_t index) { return descriptors[index]; }
+	//estadisticas base (las fija la base de prefabs al cargar)
+	static void SetStats(uint16_t index, float speed, float spriteWidth, float spriteHeight, bool displayName = false);
+	static size_t Count() { return descriptors.size(); }
+
+private:
+	static std::vector<EntityDescriptor> descriptors;
+	static std::unordered_map<std::string, uint16_t> index;
+};
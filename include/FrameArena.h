@@ -0,0 +1,111 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <string>
+#include <new>
+
+//////////////////////////////////////////////////////////////////////////////
+// Arena lineal por frame (bump allocator con doble buffer)
+// Todo lo que se reserve aqui vive durante el frame actual y el siguiente;
+// al iniciar cada frame se intercambian los buffers y se reinicia el viejo.
+// No hay free individual: reservar es mover un offset.
+// Cada hilo tiene su propia arena (la simulacion y el dibujo corren a la
+// vez) y cada uno llama NewFrame al iniciar su frame o tick.
+//////////////////////////////////////////////////////////////////////////////
+class FrameArena
+{
+public:
+	static constexpr size_t DEFAULT_CAPACITY = 1024 * 1024; // 1 MB por buffer
+
+	static FrameArena& getInstance()
+	{
+		if (!instance)
+		{
+			instance = new FrameArena(DEFAULT_CAPACITY);
+		}
+		return *instance;
+	}
+
+	//llamar una vez al inicio de cada frame
+	void BeginFrame();
+	static void NewFrame()
+	{
+		getInstance().BeginFrame();
+	}
+
+	void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+	template <typename T>
+	T* AllocateArray(size_t count)
+	{
+		return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+	}
+
+	//sprintf hacia la arena, la cadena es valida hasta el final del siguiente frame
+	const char* Format(const char* fmt, ...);
+
+	//estadisticas
+	size_t GetCapacity() const { return capacity; }
+	size_t GetUsed() const { return buffers[current].offset + buffers[current].overflowBytes; }
+	size_t GetLastFrameUsage() const { return lastFrameUsage; }
+	size_t GetHighWater() const { return highWater; }
+	//reservas que no cupieron y se fueron al heap (si pasa, subir la capacidad)
+	size_t GetOverflowCount() const { return overflowCount; }
+
+private:
+	struct Buffer
+	{
+		unsigned char* data = nullptr;
+		size_t offset = 0;
+		size_t overflowBytes = 0;
+		std::vector<void*> overflow;
+	};
+
+	static thread_local FrameArena* instance;
+
+	Buffer buffers[2];
+	int current = 0;
+	size_t capacity;
+	size_t lastFrameUsage = 0;
+	size_t highWater = 0;
+	size_t overflowCount = 0;
+
+	explicit FrameArena(size_t bytes);
+	~FrameArena();
+	FrameArena(const FrameArena&) = delete;
+	FrameArena& operator=(const FrameArena&) = delete;
+
+	void Reset(Buffer& buffer);
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// Adaptador compatible con la STL para usar la arena en contenedores
+//////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class FrameAllocator
+{
+public:
+	using value_type = T;
+
+	FrameAllocator() noexcept = default;
+	template <typename U>
+	FrameAllocator(const FrameAllocator<U>&) noexcept {}
+
+	T* allocate(size_t n)
+	{
+		return FrameArena::getInstance().AllocateArray<T>(n);
+	}
+
+	//la memoria se recupera en bloque al reiniciar el buffer
+	void deallocate(T*, size_t) noexcept {}
+
+	template <typename U>
+	bool operator==(const FrameAllocator<U>&) const noexcept { return true; }
+	template <typename U>
+	bool operator!=(const FrameAllocator<U>&) const noexcept { return false; }
+};
+
+template <typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+using FrameString = std::basic_string<char, std::char_traits<char>, FrameAllocator<char>>;
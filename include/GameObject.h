@@ -3,6 +3,12 @@
 #include "string"
 #include <iostream>
 #include <vector>
+#include "SaveData.h"
+#include "EntityDescriptor.h"
+#include "RenderQueue.h"
+#include "TransformSystem.h"
+
+struct RenderSnapshot;
 namespace Quetz_LabEDC
 {
 
@@ -10,31 +16,51 @@ namespace Quetz_LabEDC
     class GameObject
     {
 	public:
+		//id estable (se conserva al guardar y cargar)
+		uint32_t id;
 		Vector2 position;
-		std::string name;
-		//imagen del objeto
-		Texture texture;
-		bool DisplayName = false;
+		//nombre, imagen y estadisticas base viven en un descriptor compartido
+		uint16_t descriptor;
+		//nodo en la jerarquia de transformaciones (solo si esta ligado a algo)
+		TransformId transform = INVALID_TRANSFORM;
 		static std::vector<GameObject*> gameObjects;
+		static uint32_t nextId;
+		//calidad: dibujar las etiquetas de nombre (EntityDescriptor::displayName)
+		static bool drawNames;
 
 		//constructor predeterminado
 		GameObject() :
 
+			id(nextId++),
 			position({ 0,0 }),
-			name("GameObject"),
-			texture({ 0 }) {
+			descriptor(EntityDescriptors::Intern("GameObject", { 0 })) {
 		}
 
 
 		//constructor
 		GameObject(Vector2 pos, std::string _name, Texture tex) :
-			position(pos), name(_name), texture(tex) {
+			id(nextId++), position(pos), descriptor(EntityDescriptors::Intern(_name, tex)) {
 		}
+		virtual ~GameObject();
+
+		const EntityDescriptor& GetDescriptor() const { return EntityDescriptors::Get(descriptor); }
+		const std::string& GetName() const { return GetDescriptor().name; }
+		Texture2D GetTexture() const { return GetDescriptor().texture; }
+		//cambia a otro descriptor (el compartido no se modifica)
+		void SetDescriptor(const std::string& _name, Texture2D tex) { descriptor = EntityDescriptors::Intern(_name, tex); }
+
+		//guardado: copiar el estado a un registro plano y restaurarlo
+		virtual EntityType GetType() const { return EntityType::GameObject; }
+		virtual void Capture(EntityRecord& record) const;
+		virtual void Restore(const EntityRecord& record);
 
 		//actualizar posicion
 		virtual void update();
-		// dibujar o renderizar el objeto
-		virtual void draw();
+		//deja en la copia de dibujo lo que se ve del objeto (lo dibuja el hilo principal)
+		virtual void Emit(RenderSnapshot& snapshot) const;
+		//orden de dibujo: capa y profundidad (la base del sprite, mas abajo = mas al frente)
+		virtual ERenderLayer GetRenderLayer() const { return LAYER_ACTORS; }
+		virtual float GetDepth() const { return position.y + GetDescriptor().spriteHeight; }
 
     };
 }
@@ -0,0 +1,44 @@
+#pragma once
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////////
+// Generador aleatorio del juego (xorshift64*).
+// Reemplaza a rand(): en una sesion normal la semilla sale de la entropia
+// del sistema (cada partida es distinta); al grabar se fija y se guarda en
+// la repeticion, asi una sesion grabada vuelve a producir los mismos numeros.
+//////////////////////////////////////////////////////////////////////////////
+class GameRandom
+{
+public:
+	static GameRandom& getInstance()
+	{
+		if (!instance)
+		{
+			instance = new GameRandom();
+		}
+		return *instance;
+	}
+
+	void Seed(uint64_t seed);
+	uint64_t GetSeed() const { return seed; }
+
+	uint32_t Next();
+	//entero en [min, max]
+	int Range(int min, int max);
+	//flotante en [min, max)
+	float Range(float min, float max);
+
+	//estado completo, para copias del mundo
+	uint64_t GetState() const { return state; }
+	void SetState(uint64_t value) { state = value ? value : 1; }
+
+private:
+	static GameRandom* instance;
+
+	uint64_t seed = 0;
+	uint64_t state = 1;
+
+	GameRandom();
+	GameRandom(const GameRandom&) = delete;
+	GameRandom& operator=(const GameRandom&) = delete;
+};
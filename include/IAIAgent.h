@@ -0,0 +1,19 @@
+#pragma once
+#include <cstdint>
+
+enum EAITier : uint8_t; //AIScheduler.h
+
+namespace Quetz_LabEDC
+{
+	//logica de IA que corre el AIScheduler (no el update de cada frame)
+	class IAIAgent
+	{
+	public:
+		//deltaTime es todo el tiempo acumulado desde su ultimo tick
+		virtual void tick(float deltaTime) = 0;
+		//el AIScheduler le avisa cuando cambia de nivel (nace en AI_TIER_NEAR)
+		virtual void OnTierChanged(EAITier) {}
+		virtual ~IAIAgent() = default;
+
+	};
+}
@@ -0,0 +1,129 @@
+#pragma once
+#include "raylib.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//acciones del juego; cada una es un bit en InputState
+enum EInputButton : uint16_t
+{
+	INPUT_LEFT = 1 << 0,
+	INPUT_RIGHT = 1 << 1,
+	INPUT_UP = 1 << 2,
+	INPUT_DOWN = 1 << 3,
+	INPUT_PICKUP = 1 << 4,		//I: crear arma de prueba
+	INPUT_INTERACT = 1 << 5,	//F: recoger arma del suelo
+	INPUT_FIRE = 1 << 6,		//espacio
+	INPUT_NEXT_WEAPON = 1 << 7,	//tab
+	INPUT_DEBUG_DAMAGE = 1 << 8,	//H
+	INPUT_DEBUG_ENERGY = 1 << 9,	//E
+	INPUT_DEBUG_LEVEL = 1 << 10,	//L
+	INPUT_QUICK_SAVE = 1 << 11,	//F5: guardar en el slot 0
+	INPUT_QUICK_LOAD = 1 << 12,	//F9: cargar el slot 0
+	INPUT_SNAPSHOT_SAVE = 1 << 13,	//F6: copia en memoria
+	INPUT_SNAPSHOT_LOAD = 1 << 14,	//F7: volver a la copia en memoria
+	INPUT_REWIND = 1 << 15,		//retroceso
+};
+
+//ordenes de botones de UI que cambian el mundo; van en InputState::command
+enum EInputCommand : uint8_t
+{
+	INPUT_COMMAND_NONE = 0,
+	INPUT_COMMAND_SPAWN_ENEMY = 1,
+	INPUT_COMMAND_LOAD_SLOT = 16,	//+ slot elegido en el menu de carga
+};
+
+enum EInputMouse : uint8_t
+{
+	MOUSE_STATE_DOWN = 1 << 0,
+	MOUSE_STATE_PRESSED = 1 << 1,
+	MOUSE_STATE_RELEASED = 1 << 2,
+};
+
+//entrada de un tick, tal como se guarda en la repeticion (16 bytes)
+struct InputState
+{
+	float deltaTime;
+	uint16_t held;		//EInputButton mantenidos
+	uint16_t pressed;	//EInputButton presionados en este tick
+	int16_t mouseX;
+	int16_t mouseY;
+	int8_t axisX;		//stick izquierdo cuantizado a [-127, 127]
+	int8_t axisY;
+	uint8_t mouse;		//EInputMouse
+	uint8_t command;	//EInputCommand
+};
+static_assert(sizeof(InputState) == 16, "InputState se escribe tal cual en la repeticion");
+
+//////////////////////////////////////////////////////////////////////////////
+// Entrada del juego.
+// El teclado, gamepad y mouse se leen una sola vez por tick; la simulacion
+// solo consulta este estado, nunca a raylib. Asi una sesion se puede grabar
+// (una InputState por tick + la semilla) y repetir exactamente igual.
+//////////////////////////////////////////////////////////////////////////////
+class InputSystem
+{
+public:
+	static InputSystem& getInstance()
+	{
+		if (!instance)
+		{
+			instance = new InputSystem();
+		}
+		return *instance;
+	}
+
+	//llamar una vez al inicio de cada tick
+	void BeginTick(float deltaTime);
+	static void NewTick(float deltaTime)
+	{
+		getInstance().BeginTick(deltaTime);
+	}
+
+	const InputState& GetState() const { return state; }
+	bool IsDown(EInputButton button) const { return (state.held & button) != 0; }
+	bool IsPressed(EInputButton button) const { return (state.pressed & button) != 0; }
+	Vector2 GetAxis() const { return { state.axisX / 127.0f, state.axisY / 127.0f }; }
+	Vector2 GetMouse() const { return { (float)state.mouseX, (float)state.mouseY }; }
+	bool IsMouse(EInputMouse flag) const { return (state.mouse & flag) != 0; }
+	//duracion del tick (la grabada al repetir)
+	float GetDeltaTime() const { return state.deltaTime; }
+	//la UI se dibuja despues de leer la entrada: su orden entra en el siguiente tick
+	void QueueCommand(uint8_t command) { queuedCommand = command; }
+	bool IsCommand(EInputCommand command) const { return state.command == command; }
+	//slot elegido en el menu de carga en este tick, o -1
+	int GetLoadSlot() const { return state.command >= INPUT_COMMAND_LOAD_SLOT ? state.command - INPUT_COMMAND_LOAD_SLOT : -1; }
+	uint32_t GetTick() const { return tick; }
+
+	//grabar la sesion; se escribe al llamar Stop
+	void StartRecording(const std::string& path, uint64_t seed);
+	//repetir una sesion grabada, siembra el GameRandom con la semilla original
+	bool StartReplay(const std::string& path);
+	void Stop();
+
+	bool IsRecording() const { return recording; }
+	bool IsReplaying() const { return replaying; }
+	//la repeticion ya no tiene mas ticks
+	bool IsReplayFinished() const { return replayFinished; }
+
+private:
+	static InputSystem* instance;
+
+	InputState state = {};
+	uint32_t tick = 0;
+	uint8_t queuedCommand = INPUT_COMMAND_NONE;
+
+	bool recording = false;
+	bool replaying = false;
+	bool replayFinished = false;
+	std::string recordPath;
+	uint64_t recordSeed = 0;
+	std::vector<InputState> replay; //ticks grabados o por repetir
+
+	InputSystem() = default;
+	InputSystem(const InputSystem&) = delete;
+	InputSystem& operator=(const InputSystem&) = delete;
+
+	void Sample(float deltaTime);
+	bool WriteReplay() const;
+};
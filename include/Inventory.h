@@ -1,21 +1,49 @@
 #pragma once
 #include <vector>
 #include "Weapon.h"
-#include "LinkedList.h"
-#include "LLNode.h"
 using namespace Quetz_LabEDC;
+
+//un slot del inventario: un item apilable o un arma (instancia unica, count 1)
+struct InventorySlot {
+    int itemId;      //id en ItemRegistry
+    int count;
+    Weapon* weapon;  //nullptr si el slot no es un arma
+};
+
  // Forward declaration
 class Inventory {
 public:
-    LLNode<Weapon>* head = nullptr;
-    LLNode<Weapon>* tail = nullptr;
-    LLNode<Weapon>* current = nullptr;
+    static constexpr int CAPACITY = 16;
+
+	Inventory() = default;
 
-	Inventory() : head(nullptr), tail(nullptr), current(nullptr){}
+    //false si ya no hay lugar
+    bool PickupWeapon(Weapon* weapon, Player* player);
+    //apila sobre los slots del mismo item hasta su maxStack (los slots de armas no cuentan);
+    //false si no cupo todo (lo que cupo se queda)
+    bool AddItem(int itemId, int amount = 1);
+    //false (sin quitar nada) si no hay suficientes
+    bool RemoveItem(int itemId, int amount = 1);
+    int CountOf(int itemId) const;
 
-    void PickupWeapon(Weapon* weapon, Player* player);
     void NextWeapon(Player* player);
-    //std::vector<Weapon*> GetInventory() const;
+    std::vector<Weapon*> GetInventory() const;
     Weapon* GetCurrentWeapon() const ;
-};
+    //posicion del arma actual entre las armas (-1 si no hay)
+    int GetCurrentIndex() const;
+    void SetCurrentIndex(int index, Player* player);
+    void Clear();
+
+    //los slots ocupados estan juntos al inicio: recorrerlos es lineal
+    int GetSlotCount() const { return used; }
+    const InventorySlot& GetSlot(int index) const { return slots[index]; }
+    const InventorySlot* begin() const { return slots; }
+    const InventorySlot* end() const { return slots + used; }
 
+private:
+    InventorySlot slots[CAPACITY] = {};
+    int used = 0;
+    int current = -1; //slot del arma equipada
+
+    void RemoveSlot(int index);
+};
@@ -5,8 +5,10 @@ class Item
 public:
     std::string name;
     int id;
+    //cuantas unidades caben en un slot del inventario (1 = no se apila)
+    int maxStack;
 
-    Item(std::string name, int id) : name(name), id(id) {}
+    Item(std::string itemName, int itemId, int itemMaxStack = 1) : name(itemName), id(itemId), maxStack(itemMaxStack) {}
 
 
 };
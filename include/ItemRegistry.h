@@ -0,0 +1,46 @@
+#pragma once
+#include "Item.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////
+// Registro global de items, indexado por Item::id.
+// Los items se guardan juntos en un vector; las tablas hash solo guardan la
+// posicion, asi buscar por id o por nombre es O(1).
+//////////////////////////////////////////////////////////////////////////////
+class ItemRegistry
+{
+public:
+	static ItemRegistry& getInstance()
+	{
+		if (!instance)
+		{
+			instance = new ItemRegistry();
+		}
+		return *instance;
+	}
+
+	//registra un item (o regresa el id del que ya tiene ese nombre)
+	int Register(const std::string& name, int maxStack = 1);
+
+	//el puntero es valido hasta el siguiente Register
+	const Item* Find(int id) const;
+	const Item* FindByName(const std::string& name) const;
+	int GetMaxStack(int id) const;
+
+	size_t Count() const { return items.size(); }
+	const std::vector<Item>& GetItems() const { return items; }
+
+private:
+	static ItemRegistry* instance;
+
+	std::vector<Item> items;
+	std::unordered_map<int, size_t> byId;
+	std::unordered_map<std::string, int> byName;
+	int nextId = 1;
+
+	ItemRegistry();
+	ItemRegistry(const ItemRegistry&) = delete;
+	ItemRegistry& operator=(const ItemRegistry&) = delete;
+};
@@ -1,15 +1,28 @@
 #pragma once
 #include "View.h"
+#include <string>
 class Label :
     public View
 {
 public:
 
-	
-	const char* text = "Label";
 	int fontSize = 20;
+	Color color = BLACK;
+
+	const char* GetText() const { return text.c_str(); }
+	//solo invalida si el texto realmente cambio
+	void SetText(const char* newText);
+
+	//etiqueta ligada a un valor: se re-formatea solo cuando el valor cambia
+	void Bind(const char* format, int value);
+	void SetValue(int value);
 
 	void update() override;
 	void draw() override;
-};
+	void layout() override;
 
+private:
+	std::string text = "Label";
+	const char* format = nullptr;
+	int boundValue = 0;
+};
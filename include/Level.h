@@ -22,7 +22,7 @@ public:
 	static constexpr int MAP_WIDTH = 40;
 	static constexpr int MAP_HEIGHT = 25;
 
-	int tileMap[MAP_WIDTH][MAP_HEIGHT];
+	int tileMap[MAP_HEIGHT][MAP_WIDTH];
 	int decorMap[MAP_HEIGHT][MAP_WIDTH];
 
 
@@ -132,10 +132,28 @@ public:
 	void load();
 	void update();
 	void draw()
+	{
+		drawGround();
+		drawDecoration();
+	}
+
+	//las dos capas por separado, para la RenderQueue
+	void drawGround()
+	{
+		drawGround(tileMap);
+	}
+
+	void drawDecoration()
+	{
+		drawDecoration(decorMap);
+	}
+
+	//con una copia de los mapas (la de la RenderSnapshot)
+	void drawGround(const int map[MAP_HEIGHT][MAP_WIDTH]) const
 	{
 		for (int y = 0; y < MAP_HEIGHT; y++) {
 			for (int x = 0; x < MAP_WIDTH; x++) {
-				int tileIndex = tileMap[y][x];
+				int tileIndex = map[y][x];
 
 				Rectangle source = { tileIndex * TILE_SIZE, 0, TILE_SIZE, TILE_SIZE };
 				Vector2 position = { (float)(x * TILE_SIZE), (float)(y * TILE_SIZE) };
@@ -143,10 +161,13 @@ public:
 				DrawTextureRec(tileset, source, position, WHITE);
 			}
 		}
+	}
 
+	void drawDecoration(const int map[MAP_HEIGHT][MAP_WIDTH]) const
+	{
 		for (int y = 0; y < MAP_HEIGHT; y++) {
 			for (int x = 0; x < MAP_WIDTH; x++) {
-				int decorIndex = decorMap[y][x];
+				int decorIndex = map[y][x];
 				if (decorIndex != 0) { // Si hay decoracion
 					Rectangle source = { decorIndex * TILE_SIZE, 0, TILE_SIZE, TILE_SIZE };
 					Vector2 position = { (float)(x * TILE_SIZE), (float)(y * TILE_SIZE) };
@@ -154,10 +175,10 @@ public:
 				}
 			}
 		}
-
-	
 	}
 
+	unsigned int GetTilesetId() const { return tileset.id; }
+
 	bool CheckCollision(Vector2 point)
 	{
 
@@ -1,58 +1,163 @@
 #pragma once
 #include "LLNode.h"
+#include "NodePool.h"
+#include <cstddef>
+#include <iterator>
 
+//////////////////////////////////////////////////////////////////////////////
+// Lista doblemente ligada con cola.
+// Insertar y quitar en ambos extremos es O(1). Los nodos salen de un pool
+// propio de la lista; los datos (T*) no son de la lista, no se borran aqui.
+//////////////////////////////////////////////////////////////////////////////
 template <class T>
 class LinkedList
 {
-protected: 
-	//Cabecera d la lista (?)
-	LLNode<T>* head;
+protected:
+	//Cabecera y cola de la lista
+	LLNode<T>* head = nullptr;
+	LLNode<T>* tail = nullptr;
+	size_t count = 0;
+	NodePool<LLNode<T>> pool;
+
 public:
+	//iterador bidireccional sobre los datos (T*)
+	template <class NodeT, class ValueT>
+	class Iterator
+	{
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = T*;
+		using difference_type = std::ptrdiff_t;
+		using pointer = ValueT*;
+		using reference = ValueT&;
 
-	//aadir los nodos
-	LLNode<T>* addNode(T* _data)
+		Iterator(NodeT* _node, const LinkedList* _list) : node(_node), list(_list) {}
+
+		reference operator*() const { return node->data; }
+		pointer operator->() const { return &node->data; }
+		Iterator& operator++() { node = node->Next; return *this; }
+		Iterator operator++(int) { Iterator old = *this; node = node->Next; return old; }
+		//desde end() se regresa a la cola
+		Iterator& operator--() { node = node ? node->Prev : list->tail; return *this; }
+		Iterator operator--(int) { Iterator old = *this; --(*this); return old; }
+		bool operator==(const Iterator& other) const { return node == other.node; }
+		bool operator!=(const Iterator& other) const { return node != other.node; }
+
+		NodeT* GetNode() const { return node; }
+
+	private:
+		NodeT* node;
+		const LinkedList* list;
+	};
+	using iterator = Iterator<LLNode<T>, T*>;
+	using const_iterator = Iterator<const LLNode<T>, T* const>;
+
+	LinkedList() = default;
+	~LinkedList() { Clear(); }
+	LinkedList(const LinkedList&) = delete;
+	LinkedList& operator=(const LinkedList&) = delete;
+
+	iterator begin() { return iterator(head, this); }
+	iterator end() { return iterator(nullptr, this); }
+	const_iterator begin() const { return const_iterator(head, this); }
+	const_iterator end() const { return const_iterator(nullptr, this); }
+
+	LLNode<T>* Head() const { return head; }
+	LLNode<T>* Tail() const { return tail; }
+	size_t Size() const { return count; }
+	bool IsEmpty() const { return count == 0; }
+
+	LLNode<T>* PushBack(T* _data)
 	{
-		LLNode<T>* newNode = new LLNode<T>(_data);
-		if (head == nullptr)
-		{
+		LLNode<T>* newNode = pool.Create(_data);
+		newNode->Prev = tail;
+		if (tail != nullptr)
+			tail->Next = newNode;
+		else
 			head = newNode;
-		}
+		tail = newNode;
+		count++;
+		return newNode;
+	}
+
+	LLNode<T>* PushFront(T* _data)
+	{
+		LLNode<T>* newNode = pool.Create(_data, head);
+		if (head != nullptr)
+			head->Prev = newNode;
 		else
-		{
-			LLNode<T>* iter = head;
-			while (iter->Next != nullptr)
-			{
-				iter = iter->Next;
-			}
-			iter->Next = newNode;
-			newNode->Prev = iter;
-		}
+			tail = newNode;
+		head = newNode;
+		count++;
+		return newNode;
+	}
 
+	//insertar despues de un nodo de esta lista (nullptr = al inicio)
+	LLNode<T>* InsertAfter(LLNode<T>* node, T* _data)
+	{
+		if (node == nullptr)
+			return PushFront(_data);
+		if (node == tail)
+			return PushBack(_data);
+		LLNode<T>* newNode = pool.Create(_data, node->Next);
+		newNode->Prev = node;
+		node->Next->Prev = newNode;
+		node->Next = newNode;
+		count++;
 		return newNode;
 	}
 
-	//Remover el ultimo nodo
-	void RemoveLastNode()
+	//quitar un nodo de esta lista, regresa su dato
+	T* Remove(LLNode<T>* node)
 	{
-		if (head == nullptr) return;
+		if (node->Prev != nullptr)
+			node->Prev->Next = node->Next;
+		else
+			head = node->Next;
+		if (node->Next != nullptr)
+			node->Next->Prev = node->Prev;
+		else
+			tail = node->Prev;
+		T* _data = node->data;
+		pool.Destroy(node);
+		count--;
+		return _data;
+	}
+
+	T* PopFront() { return head ? Remove(head) : nullptr; }
+	T* PopBack() { return tail ? Remove(tail) : nullptr; }
 
-		if (head->Next == nullptr)
+	LLNode<T>* Find(const T* _data) const
+	{
+		for (LLNode<T>* iter = head; iter != nullptr; iter = iter->Next)
 		{
-			delete head;
-			head = nullptr;
-			return;
+			if (iter->data == _data)
+				return iter;
 		}
+		return nullptr;
+	}
 
-		LLNode<T>* iter = head;
-		while (iter->Next->Next != nullptr)
+	void Clear()
+	{
+		while (head != nullptr)
 		{
-			iter = iter->Next;
+			LLNode<T>* next = head->Next;
+			pool.Destroy(head);
+			head = next;
 		}
+		tail = nullptr;
+		count = 0;
+	}
 
-		delete iter->Next;
-		iter->Next = nullptr;
+	//aadir los nodos (al final)
+	LLNode<T>* addNode(T* _data)
+	{
+		return PushBack(_data);
 	}
 
-	
+	//Remover el ultimo nodo
+	void RemoveLastNode()
+	{
+		PopBack();
+	}
 };
-
@@ -0,0 +1,35 @@
+#pragma once
+#include "raylib.h"
+#include "SaveIndex.h"
+#include "TaskScheduler.h"
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////
+// Menu de carga: lista los slots desde el indice (una lectura) con su
+// miniatura. Las miniaturas se descomprimen en una tarea del TaskScheduler,
+// una por paso, y aparecen conforme estan. La partida se abre solo cuando
+// se elige un slot.
+//////////////////////////////////////////////////////////////////////////////
+class LoadMenu
+{
+public:
+	bool IsOpen() const { return open; }
+	void Open();
+	void Close();
+	void Toggle() { open ? Close() : Open(); }
+
+	//declara los botones del menu; regresa el slot elegido o -1
+	int update();
+	//miniaturas, despues de UISystem::Draw
+	void draw();
+
+private:
+	bool open = false;
+	std::vector<SaveSlotInfo> slots;
+	std::vector<Texture2D> thumbnails;
+	TaskId thumbnailTask = 0;
+
+	static constexpr int ROW_X = 420;
+	static constexpr int ROW_Y = 120;
+	static constexpr int ROW_HEIGHT = 48;
+};
@@ -0,0 +1,75 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////
+// Pool de nodos de tamano fijo.
+// Reserva bloques de varios nodos juntos y recicla los liberados en una
+// lista libre, asi insertar y quitar de una lista no llama a new/delete
+// despues del primer bloque (y los nodos quedan cerca en memoria).
+//////////////////////////////////////////////////////////////////////////////
+template <class N>
+class NodePool
+{
+public:
+	static constexpr size_t BLOCK_NODES = 32;
+
+	NodePool() = default;
+	~NodePool()
+	{
+		for (Slot* block : blocks)
+		{
+			::operator delete(block);
+		}
+	}
+	NodePool(const NodePool&) = delete;
+	NodePool& operator=(const NodePool&) = delete;
+
+	template <class... Args>
+	N* Create(Args&&... args)
+	{
+		if (freeList == nullptr)
+			Grow();
+		Slot* slot = freeList;
+		freeList = slot->next;
+		live++;
+		return new (slot->storage) N(std::forward<Args>(args)...);
+	}
+
+	void Destroy(N* node)
+	{
+		node->~N();
+		Slot* slot = reinterpret_cast<Slot*>(node);
+		slot->next = freeList;
+		freeList = slot;
+		live--;
+	}
+
+	size_t GetLiveCount() const { return live; }
+	size_t GetCapacity() const { return blocks.size() * BLOCK_NODES; }
+
+private:
+	union Slot
+	{
+		Slot* next;
+		alignas(N) unsigned char storage[sizeof(N)];
+	};
+
+	std::vector<Slot*> blocks;
+	Slot* freeList = nullptr;
+	size_t live = 0;
+
+	void Grow()
+	{
+		Slot* block = static_cast<Slot*>(::operator new(sizeof(Slot) * BLOCK_NODES));
+		blocks.push_back(block);
+		//en orden inverso para que se entreguen de forma ascendente
+		for (size_t i = BLOCK_NODES; i-- > 0;)
+		{
+			block[i].next = freeList;
+			freeList = &block[i];
+		}
+	}
+};
@@ -0,0 +1,35 @@
+#pragma once
+#include "View.h"
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////
+// Panel: agrupa vistas y guarda su render en una textura.
+// Mientras ningun hijo cambie, dibujar el panel es un solo blit;
+// cuando un hijo se marca sucio se vuelve a renderizar la textura.
+//////////////////////////////////////////////////////////////////////////////
+class Panel :
+    public View
+{
+public:
+	std::vector<View*> children;
+	Color background = BLANK;
+	float padding = 4.0f;
+
+	Panel(int x, int y) : View(x, y, 0, 0) {}
+	~Panel() override;
+
+	void AddChild(View* child);
+
+	void update() override;
+	void draw() override;
+	void layout() override;
+
+	//veces que se re-renderizo la textura (para medir el cache)
+	unsigned int GetRedrawCount() const { return redrawCount; }
+
+private:
+	RenderTexture2D cache = { 0 };
+	unsigned int redrawCount = 0;
+
+	void renderCache();
+};
@@ -0,0 +1,104 @@
+#pragma once
+#include "raylib.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct RenderSnapshot;
+
+using EmitterId = uint16_t;
+static constexpr EmitterId INVALID_EMITTER = 0xFFFF;
+
+//como se ve y se mueve cada tipo de efecto
+struct EmitterDesc
+{
+	Texture2D texture;          //{ 0 } = cuadros de color (textura blanca de rlgl)
+	int capacity;               //particulas vivas del emisor (pool fijo)
+	int burst;                  //particulas por disparo
+	float minSpeed, maxSpeed;   //px/s, en direccion al azar
+	float minLife, maxLife;     //segundos
+	float gravity;              //px/s^2 hacia abajo
+	float size;                 //lado del cuadro en px
+	Color startColor, endColor; //se mezclan segun la vida que le queda
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// Particulas en CPU para efectos (impactos, apariciones, recoger armas).
+// Cada emisor tiene un pool de capacidad fija en arreglos paralelos (SoA)
+// alineados: posicion, velocidad, vida y desvanecido. Update corre el mismo
+// esquema de kernel que los proyectiles (AVX / SSE2 / escalar, ver Simd.h)
+// y quita las muertas con swap-remove. Al dibujar, todas las particulas de
+// un emisor van en un solo lote con su textura. El total de vivas no pasa
+// del presupuesto que fija QualityGovernor (maxParticles).
+// Son solo visuales: usan su propio generador al azar y no se guardan, asi
+// no cambian la simulacion ni las repeticiones.
+//////////////////////////////////////////////////////////////////////////////
+class ParticleSystem
+{
+public:
+	static constexpr size_t LANES = 8;
+
+	static ParticleSystem& getInstance()
+	{
+		if (!instance)
+		{
+			instance = new ParticleSystem();
+		}
+		return *instance;
+	}
+
+	//registra un tipo de efecto (hilo principal: puede cargar su textura)
+	EmitterId AddEmitter(const std::string& name, const EmitterDesc& desc);
+	EmitterId Find(const std::string& name) const;
+
+	//lanza desc.burst particulas (o count) desde position; se recorta al presupuesto
+	void Burst(EmitterId emitter, Vector2 position, int count = -1);
+	void Burst(const std::string& name, Vector2 position, int count = -1) { Burst(Find(name), position, count); }
+
+	void Update(float deltaTime);
+	//un lote por emisor en la copia de dibujo
+	void Emit(RenderSnapshot& snapshot) const;
+	void Clear();
+
+	//tope de particulas vivas entre todos los emisores
+	void SetBudget(int value) { budget = value; }
+	int GetBudget() const { return budget; }
+	int GetLiveCount() const { return liveCount; }
+	//las que no se lanzaron por el presupuesto o por el pool lleno (desde el ultimo Update)
+	int GetDroppedLastFrame() const { return droppedLastFrame; }
+
+private:
+	static ParticleSystem* instance;
+
+	struct Emitter
+	{
+		std::string name;
+		EmitterDesc desc;
+		float* posX;
+		float* posY;
+		float* velX;
+		float* velY;
+		float* life;
+		float* invLife; //1 / vida inicial
+		float* fade;    //vida restante de 1 a 0
+		uint8_t* deadMask;
+		size_t count;
+		size_t capacity; //multiplo de LANES
+	};
+
+	std::vector<Emitter> emitters;
+	int budget = 0;
+	int liveCount = 0;
+	int dropped = 0;
+	int droppedLastFrame = 0;
+	uint32_t randomState = 0x9E3779B9u;
+
+	ParticleSystem() = default;
+	ParticleSystem(const ParticleSystem&) = delete;
+	ParticleSystem& operator=(const ParticleSystem&) = delete;
+
+	float RandomRange(float min, float max);
+	void UpdateEmitter(Emitter& emitter, float deltaTime);
+	void Compact(Emitter& emitter);
+};
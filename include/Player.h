@@ -5,6 +5,8 @@
 #include "Weapon.h"
 #include "Level.h"
 #include "Inventory.h"
+#include "TextureCache.h"
+#include "AnimationSystem.h"
 namespace Quetz_LabEDC
 {
 	enum EAnimDirection
@@ -16,11 +18,9 @@ namespace Quetz_LabEDC
 	};
 	struct SAnimData
 	{
-		int currentFrame;
-		int maxFrames;
-		//numero de frames que han de pasar para cambiar de frame en el sprite
-		int frameCounter;
-		int frameSpeed = 10;
+		//un clip por direccion (fila de la hoja); el avance lo hace AnimationSystem
+		uint16_t clips[4];
+		AnimatorId animator = INVALID_ANIMATOR;
 		float spriteWidth;
 		float spriteHeight;
 		EAnimDirection direction;
@@ -48,26 +48,29 @@ namespace Quetz_LabEDC
 			weapon(nullptr)
 			//sidekicks{ nullptr, nullptr, nullptr }
 		{
-			texture = LoadTexture("boy-r.png");
 			animData.spriteHeight = 80;
 			animData.spriteWidth = 64;
-			animData.frameCounter = 0;
-			animData.currentFrame = 0;
-			animData.maxFrames = 4;
-			animData.frameSpeed = 5;
-			name = _name;
+			SetDescriptor(_name, TextureCache::Load("boy-r.png"));
 			position = pos;
 			animData.direction = ANIM_DOWN;
+			InitAnimation();
 		}
+		~Player() { AnimationSystem::getInstance().Destroy(animData.animator); }
 		Inventory* GetInventory() { return inventory; }
+		EntityType GetType() const override { return EntityType::Player; }
+		void Capture(EntityRecord& record) const override;
+		void Restore(const EntityRecord& record) override;
 		void start();
+		void InitAnimation();
 		void update() override;
-		//sobrecargar Draw para dibujar el sprite
-		void draw() override;
+		//el sprite es el frame actual del animador
+		void Emit(RenderSnapshot& snapshot) const override;
+		//la textura es la hoja completa: la base es la del frame
+		float GetDepth() const override { return position.y + animData.spriteHeight; }
 
 		void attack()
 		{
-			std::cout << name << "Atacando" << std::endl;
+			std::cout << GetName() << "Atacando" << std::endl;
 		}
 
 		//hay que sobrecargar esta funcion a fuerzas
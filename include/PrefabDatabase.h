@@ -0,0 +1,63 @@
+#pragma once
+#include "raylib.h"
+#include "SaveData.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Quetz_LabEDC { class GameObject; }
+
+//////////////////////////////////////////////////////////////////////////////
+// Definiciones de prefabs e items desde JSON (resources/prefabs.json).
+// Cada prefab se compila a un EntityRecord plantilla; la primera carga
+// escribe un cache binario con el hash del JSON y las siguientes lo copian
+// tal cual sin parsear. Crear un prefab es copiar su plantilla.
+//////////////////////////////////////////////////////////////////////////////
+class PrefabDatabase
+{
+public:
+	static PrefabDatabase& getInstance()
+	{
+		if (!instance)
+		{
+			instance = new PrefabDatabase();
+		}
+		return *instance;
+	}
+
+	//carga desde el cache si el hash del JSON coincide; si no, parsea y lo reescribe
+	bool Load(const std::string& jsonPath, const std::string& cachePath);
+
+	const EntityRecord* Find(const std::string& name) const;
+
+	//crea el objeto con la posicion de la plantilla (no lo agrega a gameObjects)
+	Quetz_LabEDC::GameObject* Spawn(const std::string& name, Quetz_LabEDC::GameObject* owner = nullptr);
+	Quetz_LabEDC::GameObject* Spawn(const std::string& name, Vector2 position, Quetz_LabEDC::GameObject* owner = nullptr);
+
+	size_t GetPrefabCount() const { return templates.size(); }
+	bool LoadedFromCache() const { return fromCache; }
+
+private:
+	static PrefabDatabase* instance;
+
+	struct ItemEntry
+	{
+		char name[32];
+		int32_t maxStack;
+	};
+
+	std::vector<EntityRecord> templates;
+	std::vector<ItemEntry> items;
+	std::unordered_map<std::string, size_t> byName;
+	bool fromCache = false;
+
+	PrefabDatabase() = default;
+	PrefabDatabase(const PrefabDatabase&) = delete;
+	PrefabDatabase& operator=(const PrefabDatabase&) = delete;
+
+	bool ParseJson(const std::string& text);
+	bool ReadCache(const std::string& cachePath, uint64_t sourceHash);
+	void WriteCache(const std::string& cachePath, uint64_t sourceHash) const;
+	void Finish();
+};
@@ -0,0 +1,96 @@
+#pragma once
+#include "raylib.h"
+#include "SaveData.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct RenderSnapshot;
+
+//un proyectil que pego en una caja de Collide
+struct ProjectileHit
+{
+	int box;          //indice en el arreglo de cajas
+	Vector2 position; //donde estaba el proyectil al pegar
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// Proyectiles en arreglos paralelos (SoA) alineados a 32 bytes.
+// Posicion, velocidad y vida estan en arreglos separados de floats para
+// integrarlos de 8 en 8 con AVX (o de 4 en 4 con SSE2, o escalar si no
+// hay ninguno). El mismo paso marca en una mascara de bits los que salieron
+// del mundo o se les acabo la vida, y luego se quitan con swap-remove.
+// Collide prueba todos contra un lote de cajas (los enemigos) con el mismo
+// esquema. Todos comparten tipo, textura y velocidad base (el prefab).
+//////////////////////////////////////////////////////////////////////////////
+class ProjectileSystem
+{
+public:
+	static constexpr size_t LANES = 8;              //proyectiles por bloque del kernel
+	static constexpr float DEFAULT_SPEED = 300.0f;  //px/s si no hay prefab
+	static constexpr float DEFAULT_LIFETIME = 4.0f; //segundos
+
+	static ProjectileSystem& getInstance()
+	{
+		if (!instance)
+		{
+			instance = new ProjectileSystem();
+		}
+		return *instance;
+	}
+
+	//tipo, velocidad y direccion del prefab de proyectil (lo fija PrefabDatabase)
+	void SetPrefab(uint16_t descriptor, float speed, Vector2 direction);
+	//tope de proyectiles vivos (lo fija QualityGovernor)
+	void SetMaxCount(int value) { maxCount = value; }
+
+	//false si ya se llego al tope
+	bool Spawn(Vector2 position, Vector2 velocity, float lifetime = DEFAULT_LIFETIME);
+	//en la direccion y con la velocidad del prefab
+	bool Fire(Vector2 position);
+
+	//integra y quita los que salen de bounds o ya no tienen vida
+	void Update(float deltaTime, Rectangle bounds);
+	//prueba todos contra las cajas; los que pegan se quitan (un golpe por proyectil)
+	const std::vector<ProjectileHit>& Collide(const Rectangle* boxes, int boxCount);
+
+	void Emit(RenderSnapshot& snapshot) const;
+
+	//guardado: los proyectiles van como registros EntityType::Projectile
+	void Capture(size_t index, EntityRecord& record) const;
+	void Restore(const EntityRecord& record);
+	void Clear() { count = 0; }
+
+	size_t GetCount() const { return count; }
+	int GetMaxCount() const { return maxCount; }
+
+private:
+	static ProjectileSystem* instance;
+
+	float* posX = nullptr;
+	float* posY = nullptr;
+	float* velX = nullptr;
+	float* velY = nullptr;
+	float* life = nullptr;
+	uint8_t* deadMask = nullptr; //un bit por proyectil, un byte por bloque
+	size_t count = 0;
+	size_t capacity = 0; //siempre multiplo de LANES
+
+	int maxCount = 0;
+	uint16_t descriptor = 0;
+	float speed = DEFAULT_SPEED;
+	Vector2 direction = { 1, 0 };
+
+	std::vector<ProjectileHit> hits;
+
+	ProjectileSystem();
+	ProjectileSystem(const ProjectileSystem&) = delete;
+	ProjectileSystem& operator=(const ProjectileSystem&) = delete;
+
+	void Grow();
+	void Push(Vector2 position, Vector2 velocity, float lifetime);
+	//bits de los carriles validos del ultimo bloque
+	uint8_t TailMask() const;
+	//quita los marcados en deadMask moviendo el ultimo a su lugar
+	void Compact();
+};
@@ -0,0 +1,93 @@
+#pragma once
+#include <cstddef>
+
+//valores que el governor ajusta; cada nivel es una tabla fija
+struct QualitySettings
+{
+	const char* name;
+	int aiMidInterval;      //ticks entre updates de IA de nivel medio
+	int aiFarInterval;      //ticks entre updates de IA lejana
+	int aiMaxTicksPerFrame; //tope de ticks de IA media/lejana (0 = sin tope)
+	int maxProjectiles;     //proyectiles vivos a la vez
+	int maxParticles;       //particulas vivas a la vez
+	int animationInterval;  //ticks entre pasos de animacion
+	bool drawNames;         //etiquetas de nombre sobre los objetos
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// Ajuste automatico de calidad segun el tiempo medido de cada frame.
+// Guarda los ultimos SAMPLE_COUNT tiempos de trabajo (sin la espera de
+// vsync) y cada WINDOW_FRAMES frames compara el percentil 95 con el tiempo
+// objetivo. Bajar de nivel pide varias ventanas seguidas por encima del
+// objetivo y subir pide mas ventanas muy por debajo (histeresis), para no
+// oscilar entre dos niveles. Se configura desde el menu de Configuracion.
+//////////////////////////////////////////////////////////////////////////////
+class QualityGovernor
+{
+public:
+	static constexpr int LEVEL_COUNT = 4;
+	static constexpr int SAMPLE_COUNT = 120;
+	static constexpr int WINDOW_FRAMES = 30;
+
+	static QualityGovernor& getInstance()
+	{
+		if (!instance)
+		{
+			instance = new QualityGovernor();
+		}
+		return *instance;
+	}
+
+	//umbrales (fraccion del tiempo objetivo) y ventanas seguidas para cambiar
+	float downgradeRatio = 1.0f;
+	float upgradeRatio = 0.6f;
+	int downgradeWindows = 2;
+	int upgradeWindows = 6;
+
+	//tiempo de trabajo del frame en ms (medido antes de EndDrawing)
+	void AddFrame(float workMs);
+
+	void SetAuto(bool enabled);
+	bool IsAuto() const { return autoMode && !locked; }
+	//fija el nivel y aplica sus valores (0 = mejor calidad)
+	void SetLevel(int level);
+	int GetLevel() const { return level; }
+	void SetTargetFps(int fps);
+	int GetTargetFps() const { return targetFps; }
+	float GetTargetMs() const { return 1000.0f / targetFps; }
+	//grabaciones y repeticiones: nivel fijo, para que la simulacion sea la misma
+	void SetLocked(bool value) { locked = value; }
+	bool IsLocked() const { return locked; }
+
+	const QualitySettings& GetSettings() const { return GetPreset(level); }
+	static const QualitySettings& GetPreset(int level);
+
+	//percentil (0-100) de los tiempos guardados, en ms
+	float GetPercentile(float percentile) const;
+	unsigned int GetLevelChanges() const { return levelChanges; }
+
+private:
+	static QualityGovernor* instance;
+
+	float samples[SAMPLE_COUNT] = {};
+	int sampleCount = 0;
+	int sampleHead = 0;
+	int windowFrames = 0;
+	int overWindows = 0;
+	int underWindows = 0;
+
+	int level = 0;
+	int targetFps = 60;
+	bool autoMode = true;
+	bool locked = false;
+	unsigned int levelChanges = 0;
+
+	QualityGovernor() { Apply(); }
+	QualityGovernor(const QualityGovernor&) = delete;
+	QualityGovernor& operator=(const QualityGovernor&) = delete;
+
+	void Evaluate();
+	//lleva los valores del nivel a cada sistema
+	void Apply();
+	void ResetWindow();
+};
@@ -0,0 +1,81 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//capas de dibujo, de atras hacia adelante
+enum ERenderLayer : uint8_t
+{
+	LAYER_GROUND,
+	LAYER_DECORATION,
+	LAYER_ACTORS,
+	LAYER_PROJECTILES,
+	LAYER_EFFECTS,
+	LAYER_UI
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// Cola de dibujo ordenada por capa, profundidad (y) y textura.
+// Cada elemento lleva una llave de 64 bits:
+//   [63..56] capa  [55..24] y como entero ordenable  [23..0] id de textura
+// y se ordena con radix sort LSD (estable) en memoria de la FrameArena, asi
+// en un solo paso lineal quedan bien encimados los sprites y juntos los que
+// usan la misma textura. Los empates se dibujan en el orden de Submit.
+//////////////////////////////////////////////////////////////////////////////
+class RenderQueue
+{
+public:
+	using DrawFn = void (*)(void* context);
+
+	static RenderQueue& getInstance()
+	{
+		if (!instance)
+		{
+			instance = new RenderQueue();
+		}
+		return *instance;
+	}
+
+	static uint64_t MakeKey(ERenderLayer layer, float depth, unsigned int textureId);
+
+	void Submit(ERenderLayer layer, float depth, unsigned int textureId, DrawFn draw, void* context);
+	//con la llave ya calculada (ej. sprites de la RenderSnapshot)
+	void Submit(uint64_t key, DrawFn draw, void* context);
+
+	//ordena, dibuja y vacia la cola
+	void Flush();
+
+	//estadisticas del ultimo Flush
+	size_t GetLastCount() const { return lastCount; }
+	int GetLastPasses() const { return lastPasses; }
+	//cambios de textura entre elementos consecutivos
+	size_t GetLastTextureSwitches() const { return lastTextureSwitches; }
+
+private:
+	static RenderQueue* instance;
+
+	struct Item
+	{
+		DrawFn draw;
+		void* context;
+	};
+	struct SortEntry
+	{
+		uint64_t key;
+		uint32_t item;
+	};
+
+	//se reutilizan entre frames: sin reservas una vez alcanzado el maximo
+	std::vector<Item> items;
+	std::vector<uint64_t> keys;
+	size_t lastCount = 0;
+	int lastPasses = 0;
+	size_t lastTextureSwitches = 0;
+
+	RenderQueue() = default;
+	RenderQueue(const RenderQueue&) = delete;
+	RenderQueue& operator=(const RenderQueue&) = delete;
+
+	//regresa el arreglo que quedo ordenado (entries o scratch)
+	SortEntry* RadixSort(SortEntry* entries, SortEntry* scratch, size_t count);
+};
@@ -0,0 +1,72 @@
+#pragma once
+#include "raylib.h"
+#include "RenderQueue.h"
+#include "Level.h"
+#include "SaveData.h"
+#include <cstdint>
+#include <vector>
+
+struct RenderSnapshot;
+
+//un sprite ya resuelto: textura, recorte y posicion, con su llave de orden
+struct SpriteCommand
+{
+	uint64_t key; //RenderQueue::MakeKey(capa, profundidad, textura)
+	Texture2D texture;
+	Rectangle source;
+	Vector2 position;
+	char label[32]; //nombre sobre el sprite ("" = sin etiqueta)
+};
+
+//una particula: cuadro de lado size con su color ya desvanecido
+struct ParticleVertex
+{
+	float x, y;
+	float size;
+	Color color;
+};
+
+//particulas seguidas de un mismo emisor: se dibujan con un solo lote de rlgl
+struct ParticleBatch
+{
+	const RenderSnapshot* owner;
+	Texture2D texture;
+	uint32_t first;
+	uint32_t count;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// Copia inmutable de lo que se ve en un tick de simulacion.
+// La simulacion la llena al final de su tick y el hilo principal la dibuja
+// en el frame siguiente sin tocar ningun GameObject: solo datos planos
+// (sprites, mapas del nivel, valores del HUD). Los vectores se vacian sin
+// soltar memoria, asi que llenarla cada tick no reserva nada.
+//////////////////////////////////////////////////////////////////////////////
+struct RenderSnapshot
+{
+	uint32_t tick = 0;
+	std::vector<SpriteCommand> sprites;
+	std::vector<ParticleVertex> particles;
+	std::vector<ParticleBatch> particleBatches;
+	int tileMap[Level::MAP_HEIGHT][Level::MAP_WIDTH] = {};
+	int decorMap[Level::MAP_HEIGHT][Level::MAP_WIDTH] = {};
+
+	//HUD y mensajes
+	PlayerStats stats = {};
+	const char* prompt = nullptr; //texto fijo (literal), no se copia
+
+	//guardado pedido en este tick: la miniatura se toma al dibujarlo
+	int saveSlot = -1;
+	WorldState save;
+
+	//deja la copia vacia para el siguiente tick (conserva la memoria)
+	void Clear();
+
+	SpriteCommand& AddSprite(ERenderLayer layer, float depth, Texture2D texture, Rectangle source, Vector2 position);
+	//las particulas que siguen van en un lote con esta textura
+	void BeginParticleBatch(Texture2D texture);
+	void AddParticle(const ParticleVertex& particle);
+
+	//manda los sprites y lotes a la cola; el puntero debe seguir vivo hasta el Flush
+	void Submit(RenderQueue& queue) const;
+};
@@ -0,0 +1,74 @@
+#pragma once
+#include "raylib.h"
+#include <cstdint>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////
+// Estado del mundo en forma plana para guardar/cargar.
+// Los registros son POD: capturarlos es copiar campos, sin arboles JSON.
+//////////////////////////////////////////////////////////////////////////////
+
+//tipo de cada GameObject guardado (no cambiar los valores, van en el archivo)
+enum class EntityType : uint8_t
+{
+	GameObject = 0,
+	Player = 1,
+	Weapon = 2,
+	SideKick = 3,
+	Enemy = 4,
+	Projectile = 5
+};
+
+enum EEntityFlags : uint8_t
+{
+	ENTITY_DISPLAY_NAME = 1 << 0, //solo en plantillas de prefab: pasa al EntityDescriptor del tipo
+	ENTITY_IN_WORLD = 1 << 1 //esta en GameObject::gameObjects (las armas del inventario no)
+};
+
+struct EntityRecord
+{
+	uint32_t id;
+	EntityType type;
+	uint8_t flags;
+	Vector2 position;
+	//direccion (proyectil), offset (arma) o desplazamiento de camara (player)
+	Vector2 vector;
+	float speed;
+	uint32_t ownerId; //0 = sin owner
+	int32_t extra; //direccion de la animacion del player
+	char name[32];
+	char texture[64];
+};
+
+struct PlayerStats
+{
+	int health;
+	int level;
+	int energy;
+	int era;
+	float playTime;
+};
+
+//items apilables del inventario; van por nombre porque los ids de
+//ItemRegistry dependen del orden de registro de cada sesion
+struct ItemStackRecord
+{
+	char name[32];
+	int32_t count;
+};
+
+struct WorldState
+{
+	PlayerStats stats;
+	std::vector<EntityRecord> entities;
+	//armas del inventario en orden, por id de entidad
+	std::vector<uint32_t> inventory;
+	std::vector<ItemStackRecord> items;
+	int currentWeapon = -1;
+	bool hasLevel = false;
+	std::vector<int32_t> tileMap;
+	std::vector<int32_t> decorMap;
+	//captura RGBA chica de la pantalla para la miniatura del indice (no va dentro
+	//del .sav); SaveIndex la reduce a RGB en el hilo que escribe
+	std::vector<uint8_t> thumbnail;
+};
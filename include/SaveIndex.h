@@ -0,0 +1,53 @@
+#pragma once
+#include "raylib.h"
+#include "SaveData.h"
+#include <cstdint>
+#include <vector>
+
+//datos de un slot para listarlo sin abrir la partida completa
+struct SaveSlotInfo
+{
+	static constexpr int THUMB_WIDTH = 64;
+	static constexpr int THUMB_HEIGHT = 40;
+
+	uint8_t used;
+	int32_t slot;
+	int64_t timestamp; //segundos desde epoch
+	int32_t era;
+	int32_t level;
+	int32_t health;
+	float playTime;
+	uint8_t hasThumbnail;
+	uint8_t thumbnail[THUMB_WIDTH * THUMB_HEIGHT * 3]; //RGB
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// Indice de partidas (save_index.dat): un arreglo fijo de SaveSlotInfo que
+// se reescribe en cada guardado. El menu de carga lee solo este archivo;
+// la partida completa se lee unicamente cuando se elige el slot.
+//////////////////////////////////////////////////////////////////////////////
+class SaveIndex
+{
+public:
+	static constexpr int MAX_SLOTS = 16;
+	//la captura es CAPTURE_SCALE veces la miniatura; el promedio se hace al escribir
+	static constexpr int CAPTURE_SCALE = 4;
+	static constexpr int CAPTURE_WIDTH = SaveSlotInfo::THUMB_WIDTH * CAPTURE_SCALE;
+	static constexpr int CAPTURE_HEIGHT = SaveSlotInfo::THUMB_HEIGHT * CAPTURE_SCALE;
+
+	//registra un guardado; se llama desde SaveManager (puede ser otro hilo)
+	static bool Update(int slot, const WorldState& world);
+
+	//slots usados, con una sola lectura del indice
+	static std::vector<SaveSlotInfo> List();
+
+	//copia la pantalla actual ya reducida en GPU (hilo principal, antes de EndDrawing);
+	//solo se leen CAPTURE_WIDTH x CAPTURE_HEIGHT pixeles
+	static void CaptureThumbnail(std::vector<uint8_t>& rgba);
+	static Texture2D LoadThumbnailTexture(const SaveSlotInfo& info);
+
+private:
+	static bool Read(std::vector<SaveSlotInfo>& slots);
+	//promedia la captura a THUMB_WIDTH x THUMB_HEIGHT RGB
+	static bool Shrink(const std::vector<uint8_t>& rgba, uint8_t* rgb);
+};
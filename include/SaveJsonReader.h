@@ -0,0 +1,49 @@
+#pragma once
+#include "json.hpp"
+#include "SaveData.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// Lector SAX de partidas JSON: recibe eventos del parser de nlohmann y
+// escribe cada valor directo en el WorldState, sin construir el arbol.
+// Entiende el formato viejo de SaveGame y el de ExportJson.
+//////////////////////////////////////////////////////////////////////////////
+class SaveJsonReader : public nlohmann::json_sax<nlohmann::json>
+{
+public:
+	explicit SaveJsonReader(WorldState& _world) : world(_world) {}
+
+	//posicion del formato viejo (save_slotN.json de SaveGame)
+	Vector2 legacyPosition = { 400, 300 };
+	bool hasLegacyPosition = false;
+
+	bool null() override { return true; }
+	bool boolean(bool val) override { return onNumber(val ? 1.0 : 0.0); }
+	bool number_integer(number_integer_t val) override { return onNumber((double)val); }
+	bool number_unsigned(number_unsigned_t val) override { return onNumber((double)val); }
+	bool number_float(number_float_t val, const string_t&) override { return onNumber(val); }
+	bool string(string_t& val) override;
+	bool binary(binary_t&) override { return true; }
+	bool start_object(std::size_t) override;
+	bool key(string_t& val) override;
+	bool end_object() override;
+	bool start_array(std::size_t) override;
+	bool end_array() override;
+	bool parse_error(std::size_t position, const std::string& lastToken, const nlohmann::detail::exception& ex) override;
+
+private:
+	enum ERootKey { ROOT_NONE, ROOT_POSITION, ROOT_HEALTH, ROOT_LEVEL, ROOT_ENERGY, ROOT_ERA, ROOT_PLAYTIME,
+		ROOT_ENTITIES, ROOT_INVENTORY, ROOT_ITEMS, ROOT_CURRENT_WEAPON, ROOT_TILEMAP, ROOT_DECORMAP };
+	enum EEntityKey { EK_NONE, EK_ID, EK_TYPE, EK_FLAGS, EK_POSITION, EK_VECTOR, EK_SPEED, EK_OWNER, EK_EXTRA, EK_NAME, EK_TEXTURE };
+
+	WorldState& world;
+	int depth = 0;
+	ERootKey rootKey = ROOT_NONE;
+	EEntityKey entityKey = EK_NONE;
+	enum EItemKey { IK_NONE, IK_NAME, IK_COUNT };
+	EItemKey itemKey = IK_NONE;
+	int axis = -1; //0 = x, 1 = y
+	EntityRecord record;
+	ItemStackRecord stack;
+
+	bool onNumber(double value);
+};
@@ -3,8 +3,11 @@
 #include "raylib.h"
 #include <string>
 #include "json.hpp"
+#include "SaveData.h"
+#include "SaveStream.h"
 using json = nlohmann::json;
 
+namespace Quetz_LabEDC { class Player; class GameObject; }
 
 class SaveManager
 {
@@ -13,5 +16,41 @@ public:
 	static Vector2 LoadGame(int& playerHeath, int& level);*/
 	static void SaveGame(int slot, Vector2 pos, int health, int level, int era);
 	static Vector2 LoadGame(int slot, int& health, int& level, int& era);
-};
 
+	//////////////////////////////////////////////////////////////////////
+	// Formato binario versionado (save_slotN.sav):
+	// encabezado + tabla de secciones (id, offset, tamano) + secciones con
+	// campos tipados. Cubre todos los gameObjects, inventario y nivel.
+	//////////////////////////////////////////////////////////////////////
+	static constexpr uint16_t SAVE_VERSION = 1;
+
+	//copia el estado vivo del juego a un WorldState plano
+	static WorldState CaptureWorld(const PlayerStats& stats);
+	//reconstruye gameObjects, inventario y nivel; regresa el jugador
+	static Quetz_LabEDC::Player* ApplyWorld(const WorldState& world);
+	//crea el objeto del tipo del registro (sin aplicar el resto de sus campos)
+	static Quetz_LabEDC::GameObject* CreateFromRecord(const EntityRecord& record);
+
+	static void EncodeWorld(const WorldState& world, SaveWriter& out);
+	static bool DecodeWorld(const uint8_t* data, size_t size, WorldState& world);
+
+	//guardado sincrono; para no trabar el juego usar AutosaveService
+	static bool SaveWorld(int slot, const WorldState& world);
+	//lee el .sav del slot; si no existe, la exportacion JSON del mismo slot
+	static bool LoadWorld(int slot, WorldState& world);
+
+	//codifica, comprime (DEFLATE) y escribe a un .tmp que luego se renombra:
+	//un guardado interrumpido nunca deja el slot corrupto. Seguro desde otro hilo.
+	static bool WriteWorldFile(int slot, const WorldState& world, bool compress = true);
+	//escribe encabezado + cuerpo a path.tmp y lo renombra sobre path
+	static bool WriteFileAtomic(const std::string& path, const void* header, size_t headerSize, const void* body, size_t bodySize);
+
+	//exportacion JSON para depurar
+	static void ExportJson(int slot, const WorldState& world);
+	//lee una exportacion JSON por SAX, sin construir el arbol
+	static bool ImportJson(int slot, WorldState& world);
+	//compara tiempos de carga DOM contra SAX sobre el mismo archivo
+	static void BenchmarkJsonLoad(const std::string& path, int iterations);
+
+	static std::string SlotPath(int slot, const char* extension);
+};
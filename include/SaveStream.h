@@ -0,0 +1,135 @@
+#pragma once
+#include "raylib.h"
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////
+// Escritura/lectura binaria con campos tipados.
+// Cada campo es [id u8][tipo u8][valor]; el tipo permite saltar campos que
+// una version vieja no conoce. Todo se escribe en little endian (x86/ARM).
+//////////////////////////////////////////////////////////////////////////////
+enum EFieldType : uint8_t
+{
+	FIELD_I32 = 1,
+	FIELD_U32 = 2,
+	FIELD_F32 = 3,
+	FIELD_VEC2 = 4,
+	FIELD_STR = 5, //longitud u8 + bytes
+	FIELD_BLOB = 6 //longitud u32 + bytes
+};
+
+class SaveWriter
+{
+public:
+	std::vector<uint8_t> data;
+
+	size_t Size() const { return data.size(); }
+
+	void WriteRaw(const void* src, size_t size)
+	{
+		const uint8_t* bytes = static_cast<const uint8_t*>(src);
+		data.insert(data.end(), bytes, bytes + size);
+	}
+	template <typename T>
+	void Write(const T& value) { WriteRaw(&value, sizeof(T)); }
+
+	//sobrescribir un valor ya escrito (tablas de secciones, contadores)
+	template <typename T>
+	void Patch(size_t offset, const T& value) { memcpy(&data[offset], &value, sizeof(T)); }
+
+	void FieldI32(uint8_t id, int32_t value) { Write(id); Write((uint8_t)FIELD_I32); Write(value); }
+	void FieldU32(uint8_t id, uint32_t value) { Write(id); Write((uint8_t)FIELD_U32); Write(value); }
+	void FieldF32(uint8_t id, float value) { Write(id); Write((uint8_t)FIELD_F32); Write(value); }
+	void FieldVec2(uint8_t id, Vector2 value) { Write(id); Write((uint8_t)FIELD_VEC2); Write(value.x); Write(value.y); }
+	void FieldStr(uint8_t id, const char* value)
+	{
+		size_t length = strlen(value);
+		if (length > 255) length = 255;
+		Write(id); Write((uint8_t)FIELD_STR); Write((uint8_t)length);
+		WriteRaw(value, length);
+	}
+	void FieldBlob(uint8_t id, const void* src, uint32_t size)
+	{
+		Write(id); Write((uint8_t)FIELD_BLOB); Write(size);
+		WriteRaw(src, size);
+	}
+};
+
+class SaveReader
+{
+public:
+	SaveReader(const uint8_t* _data, size_t _size) : data(_data), size(_size), pos(0), failed(false) {}
+
+	bool Ok() const { return !failed; }
+	size_t Position() const { return pos; }
+	void Seek(size_t offset)
+	{
+		if (offset > size) failed = true;
+		else pos = offset;
+	}
+
+	bool ReadRaw(void* dst, size_t count)
+	{
+		if (failed || pos + count > size)
+		{
+			failed = true;
+			return false;
+		}
+		memcpy(dst, data + pos, count);
+		pos += count;
+		return true;
+	}
+	template <typename T>
+	bool Read(T& value) { return ReadRaw(&value, sizeof(T)); }
+
+	//encabezado de campo; false al llegar al final o si el archivo esta roto
+	bool FieldHeader(uint8_t& id, uint8_t& type) { return Read(id) && Read(type); }
+
+	//lectores por tipo: si el tipo no coincide se salta el valor y se deja el destino igual
+	bool ReadI32(uint8_t type, int32_t& value) { return type == FIELD_I32 ? Read(value) : Skip(type); }
+	bool ReadU32(uint8_t type, uint32_t& value) { return type == FIELD_U32 ? Read(value) : Skip(type); }
+	bool ReadF32(uint8_t type, float& value) { return type == FIELD_F32 ? Read(value) : Skip(type); }
+	bool ReadVec2(uint8_t type, Vector2& value) { return type == FIELD_VEC2 ? (Read(value.x) && Read(value.y)) : Skip(type); }
+	bool ReadStr(uint8_t type, char* dst, size_t capacity)
+	{
+		if (type != FIELD_STR) return Skip(type);
+		uint8_t length;
+		if (!Read(length)) return false;
+		size_t keep = length < capacity - 1 ? length : capacity - 1;
+		if (!ReadRaw(dst, keep)) return false;
+		dst[keep] = '\0';
+		pos += length - keep;
+		return pos <= size;
+	}
+	//devuelve el puntero a los bytes sin copiarlos
+	const uint8_t* ReadBlob(uint8_t type, uint32_t& blobSize)
+	{
+		blobSize = 0;
+		if (type != FIELD_BLOB) { Skip(type); return nullptr; }
+		if (!Read(blobSize) || pos + blobSize > size) { failed = true; return nullptr; }
+		const uint8_t* blob = data + pos;
+		pos += blobSize;
+		return blob;
+	}
+
+	bool Skip(uint8_t type)
+	{
+		switch (type)
+		{
+		case FIELD_I32: case FIELD_U32: case FIELD_F32: pos += 4; break;
+		case FIELD_VEC2: pos += 8; break;
+		case FIELD_STR: { uint8_t length; if (!Read(length)) return false; pos += length; break; }
+		case FIELD_BLOB: { uint32_t length; if (!Read(length)) return false; pos += length; break; }
+		default: failed = true; return false;
+		}
+		if (pos > size) failed = true;
+		return !failed;
+	}
+
+private:
+	const uint8_t* data;
+	size_t size;
+	size_t pos;
+	bool failed;
+};
@@ -0,0 +1,38 @@
+#pragma once
+#include "raylib.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// Pantalla de Configuracion del menu principal: calidad automatica, nivel
+// de calidad y FPS objetivo (todo va al QualityGovernor).
+// W/S eligen la opcion, A/D la cambian, Enter o retroceso regresan.
+//////////////////////////////////////////////////////////////////////////////
+class SettingsMenu
+{
+public:
+	bool IsOpen() const { return open; }
+	void Open() { open = true; selected = 0; }
+	void Close() { open = false; }
+
+	void update();
+	void draw() const;
+
+private:
+	enum ERow
+	{
+		ROW_AUTO,
+		ROW_LEVEL,
+		ROW_FPS,
+		ROW_BACK,
+		ROW_COUNT
+	};
+
+	bool open = false;
+	int selected = 0;
+
+	static constexpr int FPS_OPTIONS[] = { 30, 60, 120, 144 };
+	static constexpr int ROW_X = 480;
+	static constexpr int ROW_Y = 260;
+	static constexpr int ROW_HEIGHT = 50;
+
+	void Change(int direction);
+};
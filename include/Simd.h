@@ -0,0 +1,26 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////
+// Conjunto de instrucciones para los kernels SoA (proyectiles, particulas).
+// Se elige al compilar: AVX si el compilador lo tiene activado (/arch:AVX,
+// -mavx), si no SSE2 (siempre presente en x64), y si no hay ninguno cada
+// kernel trae su version escalar.
+//////////////////////////////////////////////////////////////////////////////
+#if defined(__AVX__)
+#include <immintrin.h>
+#define SIMD_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SIMD_SSE2
+#endif
+
+inline const char* SimdName()
+{
+#if defined(SIMD_AVX)
+	return "AVX";
+#elif defined(SIMD_SSE2)
+	return "SSE2";
+#else
+	return "escalar";
+#endif
+}
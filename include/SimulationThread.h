@@ -0,0 +1,74 @@
+#pragma once
+#include "RenderSnapshot.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+//////////////////////////////////////////////////////////////////////////////
+// Simulacion en su propio hilo, un tick por frame.
+// El hilo principal lee la entrada, arranca el tick (Kick) y mientras la
+// simulacion avanza dibuja la RenderSnapshot del tick anterior; al final
+// espera el tick (Wait) y se intercambian los dos buffers. La imagen va un
+// tick atras de la simulacion, a cambio de que el dibujo y la logica se
+// traslapen. Entre Kick y Wait el hilo principal no toca el estado del
+// juego, solo la copia que esta dibujando.
+//////////////////////////////////////////////////////////////////////////////
+class SimulationThread
+{
+public:
+	//llena la copia de este tick (corre en el hilo de simulacion)
+	using TickFn = std::function<void(RenderSnapshot& snapshot)>;
+
+	static SimulationThread& getInstance()
+	{
+		if (!instance)
+		{
+			instance = new SimulationThread();
+		}
+		return *instance;
+	}
+
+	void SetTick(TickFn fn) { tick = std::move(fn); }
+
+	//arranca un tick en el hilo de simulacion (no bloquea)
+	void Kick();
+	//espera el tick, intercambia los buffers y regresa la copia nueva
+	const RenderSnapshot& Wait();
+
+	//la copia que se dibuja este frame (la del tick anterior)
+	const RenderSnapshot& GetFront() const { return buffers[front]; }
+	//la del guardado se mueve al servicio de autoguardado
+	RenderSnapshot& GetFront() { return buffers[front]; }
+
+	//termina el tick en curso y detiene el hilo (llamar al salir)
+	void Stop();
+
+	//ms del ultimo tick y ms que el hilo principal se quedo esperandolo
+	float GetLastTickMs() const { return lastTickMs; }
+	float GetLastWaitMs() const { return lastWaitMs; }
+
+private:
+	static SimulationThread* instance;
+
+	TickFn tick;
+	RenderSnapshot buffers[2];
+	int front = 0;
+
+	std::thread worker;
+	std::mutex mutex;
+	std::condition_variable wakeUp;
+	std::condition_variable finished;
+	bool running = false;
+	bool kicked = false;
+
+	std::atomic<float> lastTickMs{ 0.0f };
+	float lastWaitMs = 0.0f;
+
+	SimulationThread() = default;
+	SimulationThread(const SimulationThread&) = delete;
+	SimulationThread& operator=(const SimulationThread&) = delete;
+
+	void Run();
+};
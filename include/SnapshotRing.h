@@ -0,0 +1,122 @@
+#pragma once
+#include "SaveData.h"
+#include "Level.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Quetz_LabEDC { class GameObject; }
+
+//////////////////////////////////////////////////////////////////////////////
+// Copias del mundo en memoria para rollback, guardado rapido y reintento.
+// Cada copia es una imagen plana (cabecera + EntityRecord + inventario:
+// ids de las armas y pares item/cantidad + mapas del nivel) dividida en paginas. Las paginas que no cambiaron desde
+// la copia anterior se comparten, asi cada tick nuevo solo copia lo que
+// se modifico. La memoria se reserva al construir el anillo; si el mundo
+// ya no cabe en la imagen, esta crece al doble y se descartan las copias
+// que habia (su distribucion ya no sirve).
+// Al restaurar, si siguen vivas las mismas entidades (mismos ids, mismo
+// inventario) cada una se restaura en su lugar; solo si el conjunto cambio
+// se pasa por SaveManager::ApplyWorld, que crea y destruye objetos.
+//////////////////////////////////////////////////////////////////////////////
+class SnapshotRing
+{
+public:
+	static constexpr size_t PAGE_SIZE = 4096;
+	//tamano inicial de la imagen (entidades + palabras del inventario)
+	static constexpr uint32_t INITIAL_ENTITIES = 512;
+	static constexpr uint32_t INITIAL_INVENTORY = 64;
+	//los indices de pagina son de 16 bits
+	static constexpr size_t MAX_POOL_PAGES = 0xFFFF;
+	static constexpr int DEFAULT_CAPACITY = 60; //un segundo a 60 fps
+
+	explicit SnapshotRing(int slotCount = DEFAULT_CAPACITY);
+	~SnapshotRing();
+	SnapshotRing(const SnapshotRing&) = delete;
+	SnapshotRing& operator=(const SnapshotRing&) = delete;
+
+	//copia el estado actual como la mas nueva; false si no cabe ni creciendo
+	bool Capture(const PlayerStats& stats, uint32_t tick);
+	//vuelve a la copia de hace 'age' capturas (0 = la mas nueva) y descarta las posteriores
+	bool Restore(int age, PlayerStats& stats);
+	void Clear();
+
+	int GetCount() const { return count; }
+	int GetCapacity() const { return capacity; }
+	uint32_t GetTick(int age) const;
+	//paginas que cambiaron respecto a la copia anterior
+	int GetDirtyPages(int age) const;
+	bool IsPageDirty(int age, int page) const;
+	int GetPageCount() const { return (int)pageCount; }
+	uint32_t GetMaxEntities() const { return maxEntities; }
+	int GetUsedPages() const { return poolPages - (int)freePages.size(); }
+	float GetLastCaptureMs() const { return lastCaptureMs; }
+	float GetLastRestoreMs() const { return lastRestoreMs; }
+
+private:
+	struct Header
+	{
+		uint32_t tick;
+		uint32_t nextId;
+		uint64_t rngState;
+		PlayerStats stats;
+		uint32_t entityCount;
+		uint32_t inventoryCount;
+		int32_t currentWeapon;
+		uint32_t itemCount;
+	};
+
+	//distribucion de la imagen; lo que sigue a las entidades se mueve al crecer
+	static constexpr size_t MAP_CELLS = Level::MAP_WIDTH * Level::MAP_HEIGHT;
+	static constexpr size_t ENTITIES_OFFSET = (sizeof(Header) + 15) & ~(size_t)15;
+	uint32_t maxEntities = 0;
+	uint32_t maxInventory = 0;
+	size_t inventoryOffset = 0;
+	size_t tileMapOffset = 0;
+	size_t decorMapOffset = 0;
+	size_t pageCount = 0;
+
+	struct Slot
+	{
+		uint32_t tick = 0;
+		std::vector<uint16_t> pages;
+		std::vector<uint64_t> dirty;
+		int dirtyCount = 0;
+	};
+
+	int capacity;
+	int head = 0;  //siguiente slot a escribir
+	int count = 0;
+	std::vector<Slot> slots;
+
+	//paginas compartidas entre copias, con cuenta de referencias
+	int poolPages = 0;
+	unsigned char* pool = nullptr;
+	std::vector<uint16_t> refCount;
+	std::vector<uint16_t> freePages;
+
+	//imagen de trabajo: siempre igual a la copia mas nueva
+	unsigned char* staging = nullptr;
+	uint32_t stagedEntities = 0;
+	uint32_t stagedInventory = 0;
+	//lo que pidio la ultima imagen que no cupo
+	uint32_t requiredEntities = 0;
+	uint32_t requiredInventory = 0;
+	bool overflowLogged = false;
+	//reutilizados al restaurar para no reservar memoria cada vez
+	WorldState restoreScratch;
+	std::vector<Quetz_LabEDC::GameObject*> restoreObjects;
+
+	float lastCaptureMs = 0.0f;
+	float lastRestoreMs = 0.0f;
+
+	int SlotIndex(int age) const { return (head - 1 - age + capacity) % capacity; }
+	unsigned char* Page(uint16_t index) const { return pool + (size_t)index * PAGE_SIZE; }
+	//reserva la imagen y las paginas para ese tamano; descarta todas las copias
+	bool Layout(uint32_t entities, uint32_t inventorySize);
+	bool WriteImage(const PlayerStats& stats, uint32_t tick);
+	//restaura sobre los objetos actuales; false si el conjunto de entidades cambio
+	bool RestoreInPlace(const Header& header);
+	void ReleaseSlot(Slot& slot);
+	void DropOldest();
+};
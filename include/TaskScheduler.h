@@ -0,0 +1,100 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+
+enum ETaskPriority : uint8_t
+{
+	TASK_HIGH,
+	TASK_NORMAL,
+	TASK_LOW,
+	TASK_PRIORITY_COUNT
+};
+
+using TaskId = uint32_t;
+//un paso de trabajo corto; regresa true cuando la tarea termino
+using TaskStep = std::function<bool()>;
+
+//////////////////////////////////////////////////////////////////////////////
+// Planificador cooperativo de trabajo largo.
+// Las tareas se parten en pasos (TaskStep) y se encolan por prioridad. Una
+// vez por frame RunFrame() corre pasos mientras quepan en el presupuesto en
+// ms (segun lo que tardo el paso anterior de cada tarea) y el resto espera
+// al siguiente frame. Dentro de una prioridad se turnan; una
+// cola que lleva muchos frames sin correr recibe un paso antes que las demas
+// para que las tareas de baja prioridad no se queden esperando siempre.
+// Todo corre en el hilo principal, despues de SimulationThread::Wait (puede
+// usar raylib y el mundo: el hilo de simulacion ya no lo esta tocando).
+//////////////////////////////////////////////////////////////////////////////
+class TaskScheduler
+{
+public:
+	static constexpr float DEFAULT_BUDGET_MS = 2.0f;
+	//frames sin correr antes de dar un paso a una cola de menor prioridad
+	static constexpr int STARVATION_FRAMES = 30;
+
+	static TaskScheduler& getInstance()
+	{
+		if (!instance)
+		{
+			instance = new TaskScheduler();
+		}
+		return *instance;
+	}
+
+	TaskId Submit(TaskStep step, ETaskPriority priority = TASK_NORMAL, const char* name = "");
+	//false si ya termino o no existe
+	bool Cancel(TaskId task);
+	bool IsPending(TaskId task) const;
+
+	//una vez por frame
+	void RunFrame();
+	//corre todo lo pendiente sin presupuesto (al salir)
+	void Flush();
+
+	void SetBudgetMs(float ms) { budgetMs = ms > 0.0f ? ms : 0.0f; }
+	float GetBudgetMs() const { return budgetMs; }
+
+	//estadisticas
+	size_t GetQueueDepth() const;
+	size_t GetQueueDepth(ETaskPriority priority) const { return queues[priority].size(); }
+	float GetLastFrameMs() const { return lastFrameMs; }
+	int GetLastFrameSteps() const { return lastFrameSteps; }
+	//frames en que un paso se paso del presupuesto
+	unsigned int GetOverrunFrames() const { return overrunFrames; }
+	unsigned int GetCompletedCount() const { return completedCount; }
+	//paso mas largo visto (para partir mejor las tareas)
+	float GetWorstStepMs() const { return worstStepMs; }
+	const char* GetWorstStepName() const { return worstStepName; }
+
+private:
+	static TaskScheduler* instance;
+
+	struct Task
+	{
+		TaskId id;
+		TaskStep step;
+		const char* name;
+		float lastMs; //duracion de su ultimo paso, para saber si cabe otro
+	};
+
+	std::deque<Task> queues[TASK_PRIORITY_COUNT];
+	int starvedFrames[TASK_PRIORITY_COUNT] = {};
+	TaskId nextId = 1;
+	float budgetMs = DEFAULT_BUDGET_MS;
+
+	float lastFrameMs = 0.0f;
+	int lastFrameSteps = 0;
+	unsigned int overrunFrames = 0;
+	unsigned int completedCount = 0;
+	float worstStepMs = 0.0f;
+	const char* worstStepName = "";
+
+	TaskScheduler() = default;
+	TaskScheduler(const TaskScheduler&) = delete;
+	TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+	//corre un paso de la cola; regresa su duracion en ms
+	float RunStep(int priority);
+};
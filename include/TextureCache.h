@@ -0,0 +1,28 @@
+#pragma once
+#include "raylib.h"
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+//////////////////////////////////////////////////////////////////////////////
+// Cache de texturas por ruta: cada archivo se carga una sola vez y se
+// recuerda de donde vino cada textura (lo necesita el guardado para
+// poder reconstruir los objetos).
+// Se puede consultar desde el hilo de simulacion, pero solo el hilo que
+// cargo la primera textura (el del contexto OpenGL) sube texturas nuevas.
+//////////////////////////////////////////////////////////////////////////////
+class TextureCache
+{
+public:
+	static Texture2D Load(const std::string& path);
+	//ruta con la que se cargo la textura, "" si no vino del cache
+	static const char* PathOf(const Texture2D& texture);
+	static void UnloadAll();
+
+private:
+	static std::unordered_map<std::string, Texture2D> textures;
+	static std::unordered_map<unsigned int, std::string> paths; //id de GPU -> ruta
+	static std::mutex mutex;
+	static std::thread::id glThread;
+};
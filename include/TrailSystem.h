@@ -0,0 +1,79 @@
+#pragma once
+#include "raylib.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Quetz_LabEDC { class GameObject; }
+
+using TrailId = uint16_t;
+static constexpr TrailId INVALID_TRAIL = 0xFFFF;
+
+//////////////////////////////////////////////////////////////////////////////
+// Rastro de posiciones para seguir en fila (sidekicks detras del jugador).
+// Cada lider guarda en un buffer circular los puntos por donde paso, uno
+// cada SAMPLE_SPACING px recorridos (no por tick: asi la distancia sobre
+// el rastro es solo indice * SAMPLE_SPACING). Cada seguidor toma un lugar
+// de la formacion y su punto esta (lugar + 1) * followGap px atras sobre
+// el camino real del lider: se calcula con dos muestras y una mezcla, O(1)
+// por seguidor, sin buscar caminos y sin atravesar paredes que el lider
+// rodeo. El rastro no se guarda; al cargar o retroceder se vacia y los
+// seguidores esperan a que el lider vuelva a dejar camino.
+//////////////////////////////////////////////////////////////////////////////
+class TrailSystem
+{
+public:
+	static constexpr float SAMPLE_SPACING = 8.0f;
+	static constexpr size_t MAX_SAMPLES = 128; //1024 px de rastro por lider
+
+	static TrailSystem& getInstance()
+	{
+		if (!instance)
+		{
+			instance = new TrailSystem();
+		}
+		return *instance;
+	}
+
+	//distancia entre lugares de la formacion (px sobre el rastro)
+	float followGap = 48.0f;
+
+	//el seguidor entra en el primer lugar libre del lider; regresa el lugar,
+	//o -1 si la fila ya no cabe en el rastro (GetMaxFollowers)
+	int Join(Quetz_LabEDC::GameObject* leader, Quetz_LabEDC::GameObject* follower, TrailId& trail);
+	void Leave(TrailId trail, int slot);
+
+	//agrega las muestras de lo que avanzo cada lider (una vez por tick)
+	void Update();
+	//punto del lugar sobre el rastro; false si el rastro aun es mas corto
+	bool GetSlotPoint(TrailId trail, int slot, Vector2& point) const;
+
+	//olvida los rastros (los lugares se conservan)
+	void Clear();
+
+	size_t GetLeaderCount() const { return trails.size(); }
+	//lugares que caben en MAX_SAMPLES muestras con el followGap actual
+	int GetMaxFollowers() const;
+
+private:
+	static TrailSystem* instance;
+
+	struct Trail
+	{
+		Quetz_LabEDC::GameObject* leader;
+		Vector2 samples[MAX_SAMPLES]; //circular: head es la mas nueva
+		size_t head;
+		size_t count;
+		std::vector<Quetz_LabEDC::GameObject*> slots; //nullptr = libre
+		int followers;
+	};
+
+	std::vector<Trail> trails;
+
+	TrailSystem() = default;
+	TrailSystem(const TrailSystem&) = delete;
+	TrailSystem& operator=(const TrailSystem&) = delete;
+
+	void Restart(Trail& trail);
+	void Push(Trail& trail, Vector2 sample);
+};
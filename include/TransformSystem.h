@@ -0,0 +1,102 @@
+#pragma once
+#include "raylib.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Quetz_LabEDC { class GameObject; }
+
+using TransformId = uint32_t;
+static constexpr TransformId INVALID_TRANSFORM = 0xFFFFFFFFu;
+
+//////////////////////////////////////////////////////////////////////////////
+// Jerarquia de transformaciones padre/hijo.
+// Los nodos viven en un arreglo plano con el padre siempre antes que sus
+// hijos, asi Update() resuelve todo en un solo recorrido: un nodo se
+// recalcula solo si el o su padre cambiaron. Cambiar la jerarquia no
+// recorre subarboles: solo marca el orden como sucio si el padre quedo
+// despues, y Reorder lo rehace en O(n) con un indice de hijos.
+// Un nodo puede estar ligado a un GameObject: si es raiz toma la posicion
+// del objeto; si tiene padre, le escribe su posicion de mundo.
+// Los ids son estables aunque el arreglo se reordene.
+//////////////////////////////////////////////////////////////////////////////
+class TransformSystem
+{
+public:
+	static TransformSystem& getInstance()
+	{
+		if (!instance)
+		{
+			instance = new TransformSystem();
+		}
+		return *instance;
+	}
+
+	TransformId Create(Vector2 local, TransformId parent = INVALID_TRANSFORM);
+	//los hijos quedan como raices en su posicion de mundo actual
+	void Destroy(TransformId node);
+
+	//keepWorld: recalcula la posicion local para no moverse al cambiar de padre
+	void SetParent(TransformId node, TransformId parent, bool keepWorld = false);
+	void SetLocal(TransformId node, Vector2 local);
+	Vector2 GetLocal(TransformId node) const;
+	Vector2 GetWorld(TransformId node) const;
+	TransformId GetParent(TransformId node) const;
+
+	//atajos para objetos
+	//nodo del objeto (lo crea como raiz si no tiene)
+	TransformId Bind(Quetz_LabEDC::GameObject* obj);
+	//cuelga el objeto de otro con un desplazamiento
+	void Attach(Quetz_LabEDC::GameObject* child, Quetz_LabEDC::GameObject* parent, Vector2 offset);
+	//suelta el objeto donde esta
+	void Detach(Quetz_LabEDC::GameObject* child);
+	//lo llama el destructor de GameObject
+	void Release(Quetz_LabEDC::GameObject* obj);
+
+	//una vez por tick, despues de los update de los objetos
+	void Update();
+
+	size_t GetCount() const { return nodes.size(); }
+	size_t GetLastUpdated() const { return lastUpdated; }
+
+private:
+	static TransformSystem* instance;
+
+	enum : uint8_t
+	{
+		NODE_DIRTY = 1,   //cambio su local o su padre
+		NODE_CHANGED = 2, //su mundo cambio en este recorrido (lo leen los hijos)
+	};
+
+	struct Node
+	{
+		Vector2 local;
+		Vector2 world;
+		TransformId id;
+		TransformId parent;
+		uint32_t parentSlot; //cache de la posicion del padre, valido si !orderDirty
+		Quetz_LabEDC::GameObject* object;
+		uint8_t flags;
+	};
+
+	std::vector<Node> nodes;        //ordenado por profundidad
+	std::vector<uint32_t> slotOf;   //id -> posicion
+	std::vector<TransformId> freeIds;
+	std::vector<Node> sortScratch;
+	std::vector<uint32_t> childStart; //indice de hijos por posicion (solo en Reorder)
+	std::vector<uint32_t> childSlots;
+	std::vector<uint32_t> visitOrder;
+	bool orderDirty = false;
+	size_t lastUpdated = 0;
+
+	TransformSystem() = default;
+	TransformSystem(const TransformSystem&) = delete;
+	TransformSystem& operator=(const TransformSystem&) = delete;
+
+	Node* Find(TransformId node);
+	const Node* Find(TransformId node) const;
+	Vector2 ParentWorld(const Node& node) const;
+	//tras cambiar el padre: el orden solo se rompe si el padre quedo despues
+	void CheckOrder(const Node& node);
+	void Reorder();
+};
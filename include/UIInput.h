@@ -0,0 +1,72 @@
+#pragma once
+#include "raylib.h"
+#include "View.h"
+#include <cstddef>
+#include <vector>
+
+//estado de entrada de la UI, se lee una sola vez por frame
+struct UIInputState
+{
+	Vector2 mouse;
+	bool mousePressed;
+	bool mouseReleased;
+	bool mouseDown;
+	static constexpr int MAX_KEYS = 8;
+	int keys[MAX_KEYS]; //teclas presionadas en este frame
+	int keyCount;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// Despachador central de eventos de UI.
+// Las vistas interactivas se guardan en una rejilla uniforme sobre la
+// pantalla; para saber que hay bajo el mouse solo se revisa una celda y
+// gana la de mayor zOrder. Los eventos solo llegan a las vistas afectadas.
+// La rejilla se rehace sola si cambia la lista de vistas, el rect de una
+// vista interactiva o el tamano de la pantalla; visible y zOrder se leen
+// al probar, asi que cambiarlos no la invalida.
+//////////////////////////////////////////////////////////////////////////////
+class UIInputDispatcher
+{
+public:
+	static constexpr int CELL_SIZE = 64;
+
+	void Sample();
+	const UIInputState& GetState() const { return state; }
+
+	//un widget inmediato ya uso el clic de este frame
+	void ConsumeClick() { state.mousePressed = false; }
+
+	//forzar la reconstruccion (p. ej. si una vista cambia de IsInteractive)
+	void Invalidate() { indexDirty = true; }
+	void Rebuild(const std::vector<View*>& views);
+
+	View* HitTest(Vector2 point) const;
+	void Dispatch(const std::vector<View*>& views);
+
+	View* GetHovered() const { return hovered; }
+	View* GetFocused() const { return focused; }
+	//lo llama ~View: suelta hover/foco y no vuelve a tocar el puntero
+	void Forget(View* view);
+
+private:
+	UIInputState state = {};
+	bool indexDirty = true;
+	//con lo que se construyo la rejilla, para saber si sigue valida
+	std::vector<View*> indexedViews;
+	std::vector<Rectangle> indexedRects; //uno por entry
+	int indexedWidth = 0;
+	int indexedHeight = 0;
+
+	int cols = 0;
+	int rows = 0;
+	//rejilla compacta: cellStart[c]..cellStart[c+1] son indices en cellItems
+	std::vector<int> cellStart;
+	std::vector<int> cellItems;
+	std::vector<View*> entries;
+
+	View* hovered = nullptr;
+	View* focused = nullptr;
+
+	int CellOf(float x, float y) const;
+	bool IndexStale(const std::vector<View*>& views) const;
+};
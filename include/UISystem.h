@@ -3,7 +3,11 @@
 #include <vector>
 #include "View.h"
 #include "Label.h"
+#include "Panel.h"
+#include "UIInput.h"
 #include <string>
+#include <cstdint>
+#include <unordered_map>
 class UISystem
 {
 public:
@@ -15,12 +19,11 @@ public:
 	Label* healthLabel;
 	Label* levelLabel;
 	Label* energyLabel;
+	//el HUD se renderiza a una textura y solo se redibuja cuando cambia un valor
+	Panel* hudPanel;
 
 	void InitHUD(int health, int level, int energy); // Inicializa los valores
 	void UpdateHUD(int health, int level, int energy); // Actualiza el HUD
-	char buffer[64];
-	char buffer2[64];
-	char buffer3[64];
 
 	static UISystem& getInstance()
 	{
@@ -49,6 +52,9 @@ public:
 	std::vector<View*> views;
 
 	Label* createLabel(const char* text, int x, int y, int fontSize = 20);
+	//etiqueta dentro de un panel (no se agrega a views, la dibuja el panel)
+	Label* createLabel(Panel* panel, const char* text, int x, int y, int fontSize = 20);
+	Panel* createPanel(int x, int y);
 
 	void draw();
 	static void Draw()
@@ -62,9 +68,48 @@ public:
 		getInstance().update();
 	}
 
+	///////////////////////////////////////////////////
+	// UI en modo inmediato: los widgets se declaran cada frame con un ID
+	// estable; su estado vive en una tabla compacta y se reutiliza, asi que
+	// declarar un boton por frame cuesta una busqueda en hash y nada mas
+	///////////////////////////////////////////////////
+	struct ImWidget
+	{
+		uint32_t id;
+		Rectangle rect;
+		std::string text;
+		Color color;
+		int fontSize;
+		unsigned int lastFrame; //ultimo frame en que fue declarado
+		bool hovered;
+	};
+
+	//regresa true en el frame en que se hizo clic
+	bool DoButton(const char* id, const char* text, int x, int y, int w, int h, Color color);
+	static bool ImButton(const char* id, const char* text, int x, int y, int w, int h, Color color)
+	{
+		return getInstance().DoButton(id, text, x, y, w, h, color);
+	}
+
+	size_t GetImWidgetCount() const { return imWidgets.size(); }
+
+	//entrada de la UI: se muestrea una vez por frame y se reparte desde aqui
+	UIInputDispatcher& GetInput() { return input; }
+
 private:
 	static UISystem* instance;
 
+	UIInputDispatcher input;
+	unsigned int sampledFrame = ~0u;
+	void SampleInput();
+
+	std::vector<ImWidget> imWidgets;
+	std::unordered_map<uint32_t, int> imWidgetIndex; //id -> posicion en imWidgets
+	unsigned int imFrame = 0;
+
+	ImWidget& GetImWidget(const char* id);
+	void drawImWidgets();
+
 	UISystem() = default; // Constructor privado para evitar instanciacin externa
 	UISystem(const UISystem&) = delete; // Eliminar el constructor de copia
 	UISystem& operator=(const UISystem&) = delete; // Eliminar el operador de asignacin
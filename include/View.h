@@ -5,6 +5,10 @@ class View
 public:
 	Rectangle rect;
 	bool visible = true;
+	//panel que contiene a esta vista (nullptr si se dibuja directo)
+	View* parent = nullptr;
+	//orden de apilado para la entrada: gana la vista con mayor zOrder
+	int zOrder = 0;
 
 	//ctor por defecto
 	View() : rect({ 0, 0, 100, 100 }), visible(true) {}
@@ -13,10 +17,41 @@ public:
 	{
 		rect = { (float)x, (float)y, (float)w, (float)h };
 	}
+	//se da de baja del despachador de entrada (hover, foco, rejilla)
+	virtual ~View();
 
 	virtual void update() = 0; //metodo virtual puro, debe ser implementado por las clases derivadas
 	virtual void draw() = 0; //metodo virtual puro, debe ser implementado por las clases derivadas
 
+	//recalcula medidas (texto, tamanos); solo corre cuando la vista esta sucia
+	virtual void layout() {}
+
+	//eventos que entrega el UIInputDispatcher, solo a las vistas interactivas
+	virtual bool IsInteractive() const { return false; }
+	virtual void onMouseEnter() {}
+	virtual void onMouseExit() {}
+	virtual void onMouseClick() {}
+	virtual void onKeyPressed(int) {}
+
+	//marcar que algo cambio; el panel que la contiene tambien se invalida
+	void MarkDirty()
+	{
+		dirty = true;
+		if (parent)
+			parent->MarkDirty();
+	}
+	bool IsDirty() const { return dirty; }
+
+	//correr el layout pendiente, si lo hay
+	void Refresh()
+	{
+		if (dirty)
+		{
+			layout();
+			dirty = false;
+		}
+	}
+
 protected:
+	bool dirty = true;
 };
-
@@ -1,6 +1,7 @@
 #pragma once
 #include "GameObject.h"
 #include "IAttacker.h"
+#include "RenderSnapshot.h"
 
 #include <iostream>
 
@@ -12,8 +13,6 @@ namespace  Quetz_LabEDC
 	{
 	public:
 	
-		std::string GetName() const { return name; }
-
 		//quien carga el arma
 		Player* owner;
 		Vector2 offset; // Desplazamiento del arma respecto al jugador
@@ -27,6 +26,12 @@ namespace  Quetz_LabEDC
 		}
 
 
+		EntityType GetType() const override { return EntityType::Weapon; }
+		void Capture(EntityRecord& record) const override;
+		void Restore(const EntityRecord& record) override;
+		//equipada se dibuja justo delante de quien la carga
+		float GetDepth() const override;
+
 		void Fire() override
 		{
 			// Implementacin del ataque
@@ -43,10 +48,10 @@ namespace  Quetz_LabEDC
 			//std::cout << "Weapon update at position: " << position.x << ", " << position.y << std::endl;
 		}
 
-		void draw() override
+		void Emit(RenderSnapshot& snapshot) const override
 		{
 			Rectangle r = { 0,0,64,64 };
-			DrawTextureRec(texture, r, position, WHITE);
+			snapshot.AddSprite(GetRenderLayer(), GetDepth(), GetTexture(), r, position);
 		}
 	};
 }
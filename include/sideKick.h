@@ -1,5 +1,8 @@
 #pragma once
 #include "GameObject.h"
+#include "IAIAgent.h"
+#include "AIScheduler.h"
+#include "TrailSystem.h"
 #include "raymath.h"
 
 
@@ -7,7 +10,7 @@ namespace Quetz_LabEDC
 {
 
     class sideKick :
-        public GameObject
+        public GameObject, public IAIAgent
     {
 
 	public:
@@ -20,18 +23,48 @@ namespace Quetz_LabEDC
 			owner(nullptr),
 			GameObject(pos, _name, tex)
 		{
+			AIScheduler::getInstance().Register(this, this);
+		}
+		~sideKick()
+		{
+			AIScheduler::getInstance().Unregister(this);
+			TrailSystem::getInstance().Leave(trail, trailSlot);
+		}
+		//seguir el rastro del owner lo corre el AIScheduler
+		void tick(float deltaTime) override;
+
+		EntityType GetType() const override { return EntityType::SideKick; }
+		void Capture(EntityRecord& record) const override
+		{
+			GameObject::Capture(record);
+			record.speed = speed;
+			record.ownerId = owner ? owner->id : 0;
+		}
+		void Restore(const EntityRecord& record) override
+		{
+			GameObject::Restore(record);
+			speed = record.speed;
+			//el rastro se vacia al cargar: alcanzar de nuevo el lugar
+			inFormation = false;
 		}
-		void update() override;
 
 		void attack()
 		{
-			std::cout << name << "Atacando" << std::endl;
+			std::cout << GetName() << "Atacando" << std::endl;
 		}
 		void flee()
 		{
-			std::cout << name << "Huye como cobarde" << std::endl;
+			std::cout << GetName() << "Huye como cobarde" << std::endl;
 		}
 
+	private:
+		//lugar en la fila detras de leader (TrailSystem)
+		GameObject* leader = nullptr;
+		TrailId trail = INVALID_TRAIL;
+		int trailSlot = -1;
+		//ya llego a su lugar: desde ahi va pegado al rastro
+		bool inFormation = false;
+
 
     };
 }
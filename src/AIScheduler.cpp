@@ -0,0 +1,168 @@
+#include "AIScheduler.h"
+#include "GameObject.h"
+#include "IAIAgent.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace Quetz_LabEDC;
+
+AIScheduler* AIScheduler::instance = nullptr;
+
+void AIScheduler::Register(GameObject* obj, IAIAgent* ai)
+{
+	if (indexOf.count(obj))
+		return;
+	//nace cercano: actua desde el primer tick y la reclasificacion lo acomoda
+	Agent agent = { obj, ai, 0.0f, 0.0f, AI_TIER_NEAR, (uint8_t)(agents.size() * 7 % 256), false };
+	indexOf[obj] = agents.size();
+	agents.push_back(agent);
+	tierCounts[AI_TIER_NEAR]++;
+}
+
+void AIScheduler::Unregister(GameObject* obj)
+{
+	auto it = indexOf.find(obj);
+	if (it == indexOf.end())
+		return;
+	size_t index = it->second;
+	tierCounts[agents[index].tier]--;
+	indexOf.erase(it);
+
+	//el ultimo ocupa el hueco
+	size_t last = agents.size() - 1;
+	if (index != last)
+	{
+		agents[index] = agents[last];
+		indexOf[agents[index].obj] = index;
+	}
+	agents.pop_back();
+	if (classifyCursor >= agents.size())
+		classifyCursor = 0;
+}
+
+void AIScheduler::Wake(GameObject* obj)
+{
+	auto it = indexOf.find(obj);
+	if (it == indexOf.end())
+		return;
+	Agent& agent = agents[it->second];
+	agent.awakeTime = WAKE_SECONDS;
+	SetTier(agent, AI_TIER_NEAR);
+}
+
+void AIScheduler::WakeAround(Vector2 position, float radius)
+{
+	float radiusSq = radius * radius;
+	for (Agent& agent : agents)
+	{
+		float dx = agent.obj->position.x - position.x;
+		float dy = agent.obj->position.y - position.y;
+		if (dx * dx + dy * dy > radiusSq)
+			continue;
+		agent.awakeTime = WAKE_SECONDS;
+		SetTier(agent, AI_TIER_NEAR);
+	}
+}
+
+EAITier AIScheduler::GetTier(GameObject* obj) const
+{
+	auto it = indexOf.find(obj);
+	return it != indexOf.end() ? (EAITier)agents[it->second].tier : AI_TIER_ASLEEP;
+}
+
+void AIScheduler::SetTier(Agent& agent, EAITier tier)
+{
+	if (agent.tier == tier)
+		return;
+	tierCounts[agent.tier]--;
+	tierCounts[tier]++;
+	//al despertar no se le debe todo el tiempo que durmio
+	if (agent.tier == AI_TIER_ASLEEP)
+		agent.pendingTime = 0.0f;
+	agent.tier = tier;
+	agent.ai->OnTierChanged(tier);
+}
+
+EAITier AIScheduler::Classify(const Agent& agent, Rectangle view, Vector2 focus) const
+{
+	if (agent.awakeTime > 0.0f)
+		return AI_TIER_NEAR;
+	Vector2 position = agent.obj->position;
+	if (CheckCollisionPointRec(position, view))
+		return AI_TIER_NEAR;
+
+	//distancia al borde de la vista; el jugador tambien cuenta (puede estar fuera de ella)
+	float dx = std::max({ view.x - position.x, 0.0f, position.x - (view.x + view.width) });
+	float dy = std::max({ view.y - position.y, 0.0f, position.y - (view.y + view.height) });
+	float distance = std::min(std::sqrt(dx * dx + dy * dy),
+		std::hypot(position.x - focus.x, position.y - focus.y));
+	if (distance < midRadius)
+		return AI_TIER_MID;
+	if (distance < farRadius)
+		return AI_TIER_FAR;
+	return AI_TIER_ASLEEP;
+}
+
+void AIScheduler::Update(float deltaTime, Rectangle view, Vector2 focus)
+{
+	tickCount++;
+	ticksLastFrame = 0;
+	deferredLastFrame = 0;
+	if (agents.empty())
+		return;
+
+	//reclasificar una parte: todos pasan cada CLASSIFY_INTERVAL ticks
+	size_t slice = (agents.size() + CLASSIFY_INTERVAL - 1) / CLASSIFY_INTERVAL;
+	for (size_t n = 0; n < slice; n++)
+	{
+		if (classifyCursor >= agents.size())
+			classifyCursor = 0;
+		Agent& agent = agents[classifyCursor++];
+		SetTier(agent, Classify(agent, view, focus));
+	}
+
+	//el tick de un agente puede borrar objetos (y a otros agentes):
+	//se recorre una copia de los que les toca
+	std::vector<GameObject*>& run = runScratch;
+	run.clear();
+	int farTicks = 0;
+	for (Agent& agent : agents)
+	{
+		if (agent.awakeTime > 0.0f)
+			agent.awakeTime -= deltaTime;
+		if (agent.tier == AI_TIER_ASLEEP)
+			continue;
+		agent.pendingTime += deltaTime;
+
+		bool due = agent.due || agent.tier == AI_TIER_NEAR;
+		if (!due)
+		{
+			int interval = agent.tier == AI_TIER_MID ? midInterval : farInterval;
+			due = (tickCount + agent.phase) % interval == 0;
+		}
+		if (!due)
+			continue;
+		if (agent.tier != AI_TIER_NEAR && maxTicksPerFrame > 0 && farTicks >= maxTicksPerFrame)
+		{
+			agent.due = true; //corre en el siguiente frame sin esperar su fase
+			deferredLastFrame++;
+			continue;
+		}
+		if (agent.tier != AI_TIER_NEAR)
+			farTicks++;
+		agent.due = false;
+		run.push_back(agent.obj);
+	}
+
+	for (GameObject* obj : run)
+	{
+		auto it = indexOf.find(obj);
+		if (it == indexOf.end())
+			continue; //lo borro otro agente en este mismo tick
+		Agent& agent = agents[it->second];
+		float elapsed = agent.pendingTime;
+		agent.pendingTime = 0.0f;
+		agent.ai->tick(elapsed);
+		ticksLastFrame++;
+	}
+}
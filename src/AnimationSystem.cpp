@@ -0,0 +1,226 @@
+#include "AnimationSystem.h"
+
+AnimationSystem* AnimationSystem::instance = nullptr;
+
+static constexpr uint32_t NO_SLOT = 0xFFFFFFFFu;
+
+uint16_t AnimationSystem::AddClip(const std::string& name, Texture2D sheet, const std::vector<Rectangle>& frames,
+	const std::vector<float>& durations, EAnimLoop loop)
+{
+	auto it = clipsByName.find(name);
+	if (it != clipsByName.end())
+		return it->second;
+
+	AnimationClip clip;
+	clip.name = name;
+	clip.sheet = sheet;
+	clip.firstFrame = (uint32_t)frameRects.size();
+	clip.frameCount = (uint16_t)(frames.empty() ? 1 : frames.size());
+	clip.loop = loop;
+	if (frames.empty())
+	{
+		//sin frames: la hoja completa como unico frame
+		frameRects.push_back({ 0, 0, (float)sheet.width, (float)sheet.height });
+		frameDurations.push_back(1.0f);
+	}
+	for (size_t i = 0; i < frames.size(); i++)
+	{
+		frameRects.push_back(frames[i]);
+		//si faltan duraciones se repite la ultima; una duracion <= 0 congelaria el ciclo
+		float duration = durations.empty() ? 0.1f : durations[i < durations.size() ? i : durations.size() - 1];
+		frameDurations.push_back(duration > 0.0f ? duration : 0.001f);
+	}
+
+	uint16_t id = (uint16_t)clips.size();
+	clips.push_back(clip);
+	clipsByName[name] = id;
+	return id;
+}
+
+uint16_t AnimationSystem::AddGridClip(const std::string& name, Texture2D sheet, int row, int frameCount,
+	float frameWidth, float frameHeight, float frameDuration, EAnimLoop loop)
+{
+	auto it = clipsByName.find(name);
+	if (it != clipsByName.end())
+		return it->second;
+
+	std::vector<Rectangle> frames;
+	for (int i = 0; i < frameCount; i++)
+		frames.push_back({ frameWidth * i, frameHeight * row, frameWidth, frameHeight });
+	return AddClip(name, sheet, frames, { frameDuration }, loop);
+}
+
+int AnimationSystem::FindClip(const std::string& name) const
+{
+	auto it = clipsByName.find(name);
+	return it != clipsByName.end() ? it->second : -1;
+}
+
+AnimatorId AnimationSystem::Create(uint16_t clip)
+{
+	AnimatorId id;
+	if (!freeIds.empty())
+	{
+		id = freeIds.back();
+		freeIds.pop_back();
+	}
+	else
+	{
+		id = (AnimatorId)slotOf.size();
+		slotOf.push_back(NO_SLOT);
+	}
+	slotOf[id] = (uint32_t)states.size();
+	states.push_back({ clip, 0, 0.0f, 1.0f, 0 });
+	owners.push_back(id);
+	return id;
+}
+
+void AnimationSystem::Destroy(AnimatorId animator)
+{
+	if (!Find(animator))
+		return;
+	//el ultimo ocupa el hueco para que el arreglo siga compacto
+	uint32_t slot = slotOf[animator];
+	uint32_t last = (uint32_t)states.size() - 1;
+	if (slot != last)
+	{
+		states[slot] = states[last];
+		owners[slot] = owners[last];
+		slotOf[owners[slot]] = slot;
+	}
+	states.pop_back();
+	owners.pop_back();
+	slotOf[animator] = NO_SLOT;
+	freeIds.push_back(animator);
+}
+
+AnimationSystem::AnimatorState* AnimationSystem::Find(AnimatorId animator)
+{
+	if (animator >= slotOf.size() || slotOf[animator] == NO_SLOT)
+		return nullptr;
+	return &states[slotOf[animator]];
+}
+
+const AnimationSystem::AnimatorState* AnimationSystem::Find(AnimatorId animator) const
+{
+	if (animator >= slotOf.size() || slotOf[animator] == NO_SLOT)
+		return nullptr;
+	return &states[slotOf[animator]];
+}
+
+void AnimationSystem::Play(AnimatorId animator, uint16_t clip, bool restart)
+{
+	AnimatorState* state = Find(animator);
+	if (!state || clip >= clips.size())
+		return;
+	if (state->clip == clip && !restart)
+		return;
+	state->clip = clip;
+	state->frame = 0;
+	state->time = 0.0f;
+	state->flags &= STATE_PAUSED;
+}
+
+void AnimationSystem::SetSpeed(AnimatorId animator, float speed)
+{
+	if (AnimatorState* state = Find(animator))
+		state->speed = speed;
+}
+
+void AnimationSystem::SetPaused(AnimatorId animator, bool paused)
+{
+	if (AnimatorState* state = Find(animator))
+		state->flags = paused ? (state->flags | STATE_PAUSED) : (state->flags & ~STATE_PAUSED);
+}
+
+bool AnimationSystem::IsFinished(AnimatorId animator) const
+{
+	const AnimatorState* state = Find(animator);
+	return state && (state->flags & STATE_FINISHED);
+}
+
+void AnimationSystem::Step(float deltaTime)
+{
+	pendingTime += deltaTime;
+	if (++stepCounter < stepInterval)
+		return;
+	deltaTime = pendingTime;
+	pendingTime = 0.0f;
+	stepCounter = 0;
+
+	const AnimationClip* clipData = clips.data();
+	const float* durations = frameDurations.data();
+	for (AnimatorState& state : states)
+	{
+		if (state.flags & (STATE_PAUSED | STATE_FINISHED))
+			continue;
+		const AnimationClip& clip = clipData[state.clip];
+		state.time += deltaTime * state.speed;
+		//un dt grande puede saltar varios frames
+		float duration = durations[clip.firstFrame + state.frame];
+		while (state.time >= duration)
+		{
+			state.time -= duration;
+			if (clip.frameCount == 1)
+			{
+				state.time = 0.0f;
+				break;
+			}
+			if (state.flags & STATE_REVERSE)
+			{
+				if (state.frame == 0)
+				{
+					state.flags &= ~STATE_REVERSE;
+					state.frame = 1;
+				}
+				else
+					state.frame--;
+			}
+			else if (state.frame + 1 < clip.frameCount)
+				state.frame++;
+			else if (clip.loop == ANIM_LOOP)
+				state.frame = 0;
+			else if (clip.loop == ANIM_PINGPONG)
+			{
+				state.flags |= STATE_REVERSE;
+				state.frame--;
+			}
+			else
+			{
+				state.time = 0.0f;
+				state.flags |= STATE_FINISHED;
+				break;
+			}
+			duration = durations[clip.firstFrame + state.frame];
+		}
+	}
+}
+
+int AnimationSystem::GetFrame(AnimatorId animator) const
+{
+	const AnimatorState* state = Find(animator);
+	return state ? state->frame : 0;
+}
+
+Rectangle AnimationSystem::GetFrameRect(AnimatorId animator) const
+{
+	const AnimatorState* state = Find(animator);
+	if (!state)
+		return { 0, 0, 0, 0 };
+	return frameRects[clips[state->clip].firstFrame + state->frame];
+}
+
+Texture2D AnimationSystem::GetSheet(AnimatorId animator) const
+{
+	const AnimatorState* state = Find(animator);
+	return state ? clips[state->clip].sheet : Texture2D{ 0 };
+}
+
+void AnimationSystem::Draw(AnimatorId animator, Vector2 position, Color tint) const
+{
+	const AnimatorState* state = Find(animator);
+	if (!state)
+		return;
+	const AnimationClip& clip = clips[state->clip];
+	DrawTextureRec(clip.sheet, frameRects[clip.firstFrame + state->frame], position, tint);
+}
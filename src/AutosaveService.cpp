@@ -0,0 +1,75 @@
+#include "AutosaveService.h"
+#include "SaveManager.h"
+#include <algorithm>
+#include <chrono>
+
+AutosaveService* AutosaveService::instance = nullptr;
+
+bool AutosaveService::Tick(float deltaTime)
+{
+	timer += deltaTime;
+	if (timer < interval)
+		return false;
+	timer = 0.0f;
+	return true;
+}
+
+void AutosaveService::Submit(int slot, WorldState&& snapshot)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!running)
+		{
+			running = true;
+			worker = std::thread(&AutosaveService::Run, this);
+		}
+		//una copia sin escribir del mismo espacio queda vieja: la nueva toma su lugar
+		auto same = std::find_if(pending.begin(), pending.end(), [slot](const PendingSave& save) { return save.slot == slot; });
+		if (same != pending.end())
+			same->world = std::move(snapshot);
+		else
+			pending.push_back({ slot, std::move(snapshot) });
+		busy = true;
+	}
+	wakeUp.notify_one();
+}
+
+void AutosaveService::Run()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	while (true)
+	{
+		wakeUp.wait(lock, [this] { return !pending.empty() || !running; });
+		if (pending.empty() && !running)
+			break;
+
+		WorldState snapshot = std::move(pending.front().world);
+		int slot = pending.front().slot;
+		pending.pop_front();
+		lock.unlock();
+
+		auto start = std::chrono::steady_clock::now();
+		if (SaveManager::WriteWorldFile(slot, snapshot))
+			saveCount++;
+		else
+			failCount++;
+		lastWriteMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		lock.lock();
+		if (pending.empty())
+			busy = false;
+	}
+}
+
+void AutosaveService::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!running)
+			return;
+		running = false;
+	}
+	wakeUp.notify_one();
+	//el hilo termina de escribir lo pendiente antes de salir
+	worker.join();
+}
@@ -6,12 +6,13 @@ Button::Button(const std::string& text, int x, int y, int w, int h, Color color,
 } 
 
 void Button::update() {
-    if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && CheckCollisionPointRec(GetMousePosition(), rect)) {
-        if (onClick) onClick();  // Ejecuta la funcin asignada al botn
-    }
+}
+
+void Button::onMouseClick() {
+    if (onClick) onClick();  // Ejecuta la funcin asignada al botn
 }
 
 void Button::draw() {
-    DrawRectangle(rect.x, rect.y, rect.width, rect.height, color);  // Dibuja el botn
+    DrawRectangle(rect.x, rect.y, rect.width, rect.height, hovered ? ColorBrightness(color, 0.2f) : color);  // Dibuja el botn
     DrawText(text.c_str(), rect.x + 10, rect.y + 10, fontSize, WHITE);  // Dibuja el texto encima del botn
 }
\ No newline at end of file
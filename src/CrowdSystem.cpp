@@ -0,0 +1,361 @@
+#include "CrowdSystem.h"
+#include "GameObject.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace Quetz_LabEDC;
+
+CrowdSystem* CrowdSystem::instance = nullptr;
+
+static constexpr uint32_t NO_SLOT = 0xFFFFFFFFu;
+//tope de celdas por agente: si la horda esta muy dispersa las celdas crecen
+static constexpr size_t CELLS_PER_AGENT = 4;
+
+CrowdId CrowdSystem::Add(GameObject* obj)
+{
+	CrowdId id;
+	if (!freeIds.empty())
+	{
+		id = freeIds.back();
+		freeIds.pop_back();
+	}
+	else
+	{
+		id = (CrowdId)slotOf.size();
+		slotOf.push_back(NO_SLOT);
+	}
+	slotOf[id] = (uint32_t)objects.size();
+	objects.push_back(obj);
+	posX.push_back(obj->position.x);
+	posY.push_back(obj->position.y);
+	velX.push_back(0.0f);
+	velY.push_back(0.0f);
+	goalX.push_back(obj->position.x);
+	goalY.push_back(obj->position.y);
+	maxSpeed.push_back(0.0f);
+	hasGoal.push_back(0);
+	detail.push_back(CROWD_DETAIL_FULL);
+	owners.push_back(id);
+	return id;
+}
+
+void CrowdSystem::Remove(CrowdId agent)
+{
+	uint32_t slot = Slot(agent);
+	if (slot == NO_SLOT)
+		return;
+	//el ultimo ocupa el hueco para que los arreglos sigan compactos
+	uint32_t last = (uint32_t)objects.size() - 1;
+	if (slot != last)
+	{
+		objects[slot] = objects[last];
+		posX[slot] = posX[last];
+		posY[slot] = posY[last];
+		velX[slot] = velX[last];
+		velY[slot] = velY[last];
+		goalX[slot] = goalX[last];
+		goalY[slot] = goalY[last];
+		maxSpeed[slot] = maxSpeed[last];
+		hasGoal[slot] = hasGoal[last];
+		detail[slot] = detail[last];
+		owners[slot] = owners[last];
+		slotOf[owners[slot]] = slot;
+	}
+	objects.pop_back();
+	posX.pop_back();
+	posY.pop_back();
+	velX.pop_back();
+	velY.pop_back();
+	goalX.pop_back();
+	goalY.pop_back();
+	maxSpeed.pop_back();
+	hasGoal.pop_back();
+	detail.pop_back();
+	owners.pop_back();
+	slotOf[agent] = NO_SLOT;
+	freeIds.push_back(agent);
+}
+
+uint32_t CrowdSystem::Slot(CrowdId agent) const
+{
+	return agent < slotOf.size() ? slotOf[agent] : NO_SLOT;
+}
+
+void CrowdSystem::SetGoal(CrowdId agent, Vector2 goal, float speed)
+{
+	uint32_t slot = Slot(agent);
+	if (slot == NO_SLOT)
+		return;
+	goalX[slot] = goal.x;
+	goalY[slot] = goal.y;
+	maxSpeed[slot] = speed;
+	hasGoal[slot] = 1;
+}
+
+void CrowdSystem::ClearGoal(CrowdId agent)
+{
+	uint32_t slot = Slot(agent);
+	if (slot != NO_SLOT)
+		hasGoal[slot] = 0;
+}
+
+void CrowdSystem::SetDetail(CrowdId agent, ECrowdDetail value)
+{
+	uint32_t slot = Slot(agent);
+	if (slot != NO_SLOT)
+		detail[slot] = value;
+}
+
+Vector2 CrowdSystem::GetVelocity(CrowdId agent) const
+{
+	uint32_t slot = Slot(agent);
+	return slot != NO_SLOT ? Vector2{ velX[slot], velY[slot] } : Vector2{ 0, 0 };
+}
+
+void CrowdSystem::SetVelocity(CrowdId agent, Vector2 velocity)
+{
+	uint32_t slot = Slot(agent);
+	if (slot == NO_SLOT)
+		return;
+	velX[slot] = velocity.x;
+	velY[slot] = velocity.y;
+}
+
+void CrowdSystem::BuildGrid()
+{
+	size_t count = objects.size();
+	float minX = posX[0], maxX = posX[0], minY = posY[0], maxY = posY[0];
+	for (size_t i = 1; i < count; i++)
+	{
+		minX = std::min(minX, posX[i]);
+		maxX = std::max(maxX, posX[i]);
+		minY = std::min(minY, posY[i]);
+		maxY = std::max(maxY, posY[i]);
+	}
+
+	//celdas de al menos el radio: los vecinos siempre estan en las 3x3 de alrededor
+	cellSize = std::max(neighborRadius, 1.0f);
+	size_t maxCells = count * CELLS_PER_AGENT + 64;
+	float area = (maxX - minX + cellSize) * (maxY - minY + cellSize);
+	if (area / (cellSize * cellSize) > (float)maxCells)
+		cellSize = sqrtf(area / (float)maxCells);
+	gridMinX = minX;
+	gridMinY = minY;
+	gridWidth = (int)((maxX - minX) / cellSize) + 1;
+	gridHeight = (int)((maxY - minY) / cellSize) + 1;
+
+	//counting sort por celda
+	size_t cells = (size_t)gridWidth * gridHeight;
+	cellStart.assign(cells + 1, 0);
+	cellOf.resize(count);
+	sorted.resize(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		int cx = std::min((int)((posX[i] - gridMinX) / cellSize), gridWidth - 1);
+		int cy = std::min((int)((posY[i] - gridMinY) / cellSize), gridHeight - 1);
+		cellOf[i] = (uint32_t)(cy * gridWidth + cx);
+		cellStart[cellOf[i] + 1]++;
+	}
+	for (size_t c = 0; c < cells; c++)
+		cellStart[c + 1] += cellStart[c];
+	cellCursor.assign(cellStart.begin(), cellStart.end() - 1);
+	for (size_t i = 0; i < count; i++)
+		sorted[cellCursor[cellOf[i]]++] = (uint32_t)i;
+}
+
+size_t CrowdSystem::Steer(size_t begin, size_t end, float deltaTime)
+{
+	size_t checks = 0;
+	float radiusSq = neighborRadius * neighborRadius;
+	float blend = std::min(1.0f, steerRate * deltaTime);
+	for (size_t i = begin; i < end; i++)
+	{
+		if (detail[i] == CROWD_DETAIL_FROZEN)
+		{
+			newVelX[i] = 0.0f;
+			newVelY[i] = 0.0f;
+			continue;
+		}
+		float x = posX[i], y = posY[i];
+		float speed = maxSpeed[i];
+
+		//llegada: a toda velocidad lejos, frenando dentro de arriveRadius, quieto en stopRadius
+		float desiredX = 0.0f, desiredY = 0.0f;
+		if (hasGoal[i])
+		{
+			float dx = goalX[i] - x, dy = goalY[i] - y;
+			float distance = sqrtf(dx * dx + dy * dy);
+			if (distance > stopRadius)
+			{
+				float arrive = speed * std::min(1.0f, (distance - stopRadius) / std::max(arriveRadius, 1.0f));
+				desiredX = dx / distance * arrive;
+				desiredY = dy / distance * arrive;
+			}
+		}
+
+		//vecinos de las 3x3 celdas alrededor, en orden de celda (siempre el mismo);
+		//se corta al juntar MAX_NEIGHBORS o al revisar MAX_CANDIDATES
+		float pushX = 0.0f, pushY = 0.0f;
+		float sumVelX = 0.0f, sumVelY = 0.0f;
+		int neighbors = 0;
+		int candidates = detail[i] == CROWD_DETAIL_FULL ? 0 : MAX_CANDIDATES;
+		int cx = (int)(cellOf[i] % gridWidth), cy = (int)(cellOf[i] / gridWidth);
+		for (int ny = std::max(cy - 1, 0); ny <= std::min(cy + 1, gridHeight - 1) && neighbors < MAX_NEIGHBORS && candidates < MAX_CANDIDATES; ny++)
+		{
+			for (int nx = std::max(cx - 1, 0); nx <= std::min(cx + 1, gridWidth - 1) && neighbors < MAX_NEIGHBORS && candidates < MAX_CANDIDATES; nx++)
+			{
+				uint32_t cell = (uint32_t)(ny * gridWidth + nx);
+				for (uint32_t k = cellStart[cell]; k < cellStart[cell + 1] && neighbors < MAX_NEIGHBORS && candidates < MAX_CANDIDATES; k++)
+				{
+					uint32_t j = sorted[k];
+					if (j == i)
+						continue;
+					candidates++;
+					checks++;
+					float ox = x - posX[j], oy = y - posY[j];
+					float distanceSq = ox * ox + oy * oy;
+					if (distanceSq >= radiusSq)
+						continue;
+					float distance = sqrtf(distanceSq);
+					if (distance > 0.0f)
+					{
+						//mas fuerte mientras mas cerca
+						float weight = (1.0f - distance / neighborRadius) / distance;
+						pushX += ox * weight;
+						pushY += oy * weight;
+					}
+					else
+					{
+						//encimados exactos: se abren de lado segun el orden
+						pushX += i < j ? 1.0f : -1.0f;
+					}
+					sumVelX += velX[j];
+					sumVelY += velY[j];
+					neighbors++;
+				}
+			}
+		}
+		if (neighbors > 0)
+		{
+			float separation = speed * separationWeight;
+			desiredX += pushX * separation;
+			desiredY += pushY * separation;
+			desiredX += (sumVelX / neighbors - velX[i]) * alignmentWeight;
+			desiredY += (sumVelY / neighbors - velY[i]) * alignmentWeight;
+		}
+
+		float desiredSq = desiredX * desiredX + desiredY * desiredY;
+		if (desiredSq > speed * speed && desiredSq > 0.0f)
+		{
+			float scale = speed / sqrtf(desiredSq);
+			desiredX *= scale;
+			desiredY *= scale;
+		}
+		newVelX[i] = velX[i] + (desiredX - velX[i]) * blend;
+		newVelY[i] = velY[i] + (desiredY - velY[i]) * blend;
+	}
+	return checks;
+}
+
+void CrowdSystem::WorkerLoop(size_t index)
+{
+	uint64_t seen = 0;
+	std::unique_lock<std::mutex> lock(mutex);
+	while (true)
+	{
+		wakeUp.wait(lock, [&] { return generation != seen || stopping; });
+		if (stopping)
+			break;
+		seen = generation;
+		float deltaTime = stepDelta;
+		lock.unlock();
+
+		//el tramo 0 es del hilo que llama; los trabajadores toman los siguientes
+		size_t count = objects.size();
+		size_t parts = workers.size() + 1;
+		size_t begin = count * (index + 1) / parts;
+		size_t end = count * (index + 2) / parts;
+		workerChecks[index] = Steer(begin, end, deltaTime);
+
+		lock.lock();
+		if (--pendingWorkers == 0)
+			finished.notify_one();
+	}
+}
+
+void CrowdSystem::SteerParallel(float deltaTime)
+{
+	size_t count = objects.size();
+	if (workers.empty())
+	{
+		unsigned int hardware = std::thread::hardware_concurrency();
+		unsigned int workerCount = std::min(hardware > 1 ? hardware - 1 : 0u, MAX_WORKERS);
+		workerChecks.assign(workerCount, 0);
+		for (unsigned int i = 0; i < workerCount; i++)
+			workers.emplace_back(&CrowdSystem::WorkerLoop, this, (size_t)i);
+	}
+	if (workers.empty())
+	{
+		neighborChecks = Steer(0, count, deltaTime);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stepDelta = deltaTime;
+		pendingWorkers = workers.size();
+		generation++;
+	}
+	wakeUp.notify_all();
+	neighborChecks = Steer(0, count / (workers.size() + 1), deltaTime);
+
+	std::unique_lock<std::mutex> lock(mutex);
+	finished.wait(lock, [this] { return pendingWorkers == 0; });
+	for (size_t checks : workerChecks)
+		neighborChecks += checks;
+}
+
+void CrowdSystem::Update(float deltaTime)
+{
+	size_t count = objects.size();
+	neighborChecks = 0;
+	if (count == 0)
+		return;
+
+	//la posicion pudo cambiar fuera (carga, retroceso): se toma del objeto
+	for (size_t i = 0; i < count; i++)
+	{
+		posX[i] = objects[i]->position.x;
+		posY[i] = objects[i]->position.y;
+	}
+	BuildGrid();
+
+	newVelX.resize(count);
+	newVelY.resize(count);
+	if (count >= PARALLEL_MIN_AGENTS)
+		SteerParallel(deltaTime);
+	else
+		neighborChecks = Steer(0, count, deltaTime);
+
+	for (size_t i = 0; i < count; i++)
+	{
+		velX[i] = newVelX[i];
+		velY[i] = newVelY[i];
+		objects[i]->position.x = posX[i] + velX[i] * deltaTime;
+		objects[i]->position.y = posY[i] + velY[i] * deltaTime;
+	}
+}
+
+void CrowdSystem::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (workers.empty())
+			return;
+		stopping = true;
+	}
+	wakeUp.notify_all();
+	for (std::thread& worker : workers)
+		worker.join();
+	workers.clear();
+}
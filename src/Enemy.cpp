@@ -1,20 +1,50 @@
 #include "Enemy.h"
+#include "TextureCache.h"
+#include "AIScheduler.h"
+#include "SaveData.h"
 
 
 Enemy::Enemy(Vector2 position, const char* name, Player* player)
-    : GameObject(position, name, LoadTexture("enemy.png")), target(player) {
+    : GameObject(position, name, TextureCache::Load("enemy.png")), target(player) {
+    AIScheduler::getInstance().Register(this, this);
+    crowd = CrowdSystem::getInstance().Add(this);
 }
 
-void Enemy::update() {
+Enemy::~Enemy() {
+    AIScheduler::getInstance().Unregister(this);
+    CrowdSystem::getInstance().Remove(crowd);
+}
+
+//si no hay prefab que la defina (pixeles por segundo)
+static constexpr float DEFAULT_SPEED = 120.0f;
+
+void Enemy::tick(float) {
     if (target) {
-        Vector2 direction = { target->position.x - position.x, target->position.y - position.y };
-        float length = sqrt(direction.x * direction.x + direction.y * direction.y);
-        if (length > 0) {
-            direction.x /= length;
-            direction.y /= length;
-        }
-
-        position.x += direction.x * 2.0f; // Velocidad
-        position.y += direction.y * 2.0f;
+        float speed = GetDescriptor().speed > 0 ? GetDescriptor().speed : DEFAULT_SPEED;
+        CrowdSystem::getInstance().SetGoal(crowd, target->position, speed);
     }
-}
\ No newline at end of file
+    else {
+        CrowdSystem::getInstance().ClearGoal(crowd);
+    }
+}
+
+void Enemy::OnTierChanged(EAITier tier) {
+    ECrowdDetail detail = CROWD_DETAIL_FULL;
+    if (tier == AI_TIER_FAR)
+        detail = CROWD_DETAIL_GOAL_ONLY;
+    else if (tier == AI_TIER_ASLEEP)
+        detail = CROWD_DETAIL_FROZEN;
+    CrowdSystem::getInstance().SetDetail(crowd, detail);
+}
+
+void Enemy::Capture(EntityRecord& record) const {
+    GameObject::Capture(record);
+    record.vector = CrowdSystem::getInstance().GetVelocity(crowd);
+}
+
+void Enemy::Restore(const EntityRecord& record) {
+    GameObject::Restore(record);
+    //la meta se vuelve a fijar en el siguiente tick de IA
+    CrowdSystem::getInstance().SetVelocity(crowd, record.vector);
+    CrowdSystem::getInstance().ClearGoal(crowd);
+}
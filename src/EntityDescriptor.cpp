@@ -0,0 +1,35 @@
+#include "EntityDescriptor.h"
+#include <iostream>
+
+std::vector<EntityDescriptor> EntityDescriptors::descriptors;
+std::unordered_map<std::string, uint16_t> EntityDescriptors::index;
+
+uint16_t EntityDescriptors::Intern(const std::string& name, Texture2D texture)
+{
+	//la llave incluye el id de la textura: mismo nombre con otra imagen es otro tipo
+	std::string key = name;
+	key += '#';
+	key += std::to_string(texture.id);
+	auto it = index.find(key);
+	if (it != index.end())
+		return it->second;
+
+	if (descriptors.size() >= UINT16_MAX)
+	{
+		std::cerr << "Demasiados descriptores de entidad" << std::endl;
+		return 0;
+	}
+	uint16_t slot = (uint16_t)descriptors.size();
+	descriptors.push_back({ name, texture, 0.0f, (float)texture.width, (float)texture.height, false });
+	index.emplace(std::move(key), slot);
+	return slot;
+}
+
+void EntityDescriptors::SetStats(uint16_t slot, float speed, float spriteWidth, float spriteHeight, bool displayName)
+{
+	EntityDescriptor& descriptor = descriptors[slot];
+	descriptor.speed = speed;
+	descriptor.displayName = displayName;
+	if (spriteWidth > 0) descriptor.spriteWidth = spriteWidth;
+	if (spriteHeight > 0) descriptor.spriteHeight = spriteHeight;
+}
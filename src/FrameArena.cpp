@@ -0,0 +1,92 @@
+#include "FrameArena.h"
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+
+thread_local FrameArena* FrameArena::instance = nullptr;
+
+//alineacion de los bloques que no caben en la arena (cubre SIMD)
+static constexpr size_t OVERFLOW_ALIGNMENT = 64;
+
+FrameArena::FrameArena(size_t bytes) : capacity(bytes)
+{
+	for (Buffer& buffer : buffers)
+	{
+		buffer.data = static_cast<unsigned char*>(::operator new(capacity));
+	}
+}
+
+FrameArena::~FrameArena()
+{
+	for (Buffer& buffer : buffers)
+	{
+		Reset(buffer);
+		::operator delete(buffer.data);
+	}
+}
+
+void FrameArena::Reset(Buffer& buffer)
+{
+	for (void* block : buffer.overflow)
+	{
+		::operator delete(block, std::align_val_t(OVERFLOW_ALIGNMENT));
+	}
+	buffer.overflow.clear();
+	buffer.offset = 0;
+	buffer.overflowBytes = 0;
+}
+
+void FrameArena::BeginFrame()
+{
+	//registrar lo que consumio el frame que termina
+	lastFrameUsage = GetUsed();
+	if (lastFrameUsage > highWater)
+		highWater = lastFrameUsage;
+
+	//el buffer del frame anterior sigue vivo, se reinicia el de hace dos frames
+	current = 1 - current;
+	Reset(buffers[current]);
+}
+
+void* FrameArena::Allocate(size_t size, size_t alignment)
+{
+	Buffer& buffer = buffers[current];
+
+	uintptr_t base = reinterpret_cast<uintptr_t>(buffer.data);
+	uintptr_t aligned = (base + buffer.offset + alignment - 1) & ~(uintptr_t)(alignment - 1);
+	size_t newOffset = (aligned - base) + size;
+
+	if (newOffset <= capacity)
+	{
+		buffer.offset = newOffset;
+		return reinterpret_cast<void*>(aligned);
+	}
+
+	//no cabe: se va al heap y se libera junto con el buffer
+	void* block = ::operator new(size, std::align_val_t(OVERFLOW_ALIGNMENT));
+	buffer.overflow.push_back(block);
+	buffer.overflowBytes += size;
+	overflowCount++;
+	return block;
+}
+
+const char* FrameArena::Format(const char* fmt, ...)
+{
+	va_list args;
+	va_start(args, fmt);
+	va_list argsCopy;
+	va_copy(argsCopy, args);
+	int length = vsnprintf(nullptr, 0, fmt, argsCopy);
+	va_end(argsCopy);
+
+	if (length < 0)
+	{
+		va_end(args);
+		return "";
+	}
+
+	char* text = AllocateArray<char>((size_t)length + 1);
+	vsnprintf(text, (size_t)length + 1, fmt, args);
+	va_end(args);
+	return text;
+}
@@ -1,20 +1,55 @@
 #include "GameObject.h"
+#include "TextureCache.h"
+#include "RenderSnapshot.h"
+#include <cstring>
 
 using namespace Quetz_LabEDC;
 
 std::vector<GameObject*> GameObject::gameObjects;
-void GameObject::update()
+uint32_t GameObject::nextId = 1;
+bool GameObject::drawNames = true;
+
+GameObject::~GameObject()
+{
+	if (transform != INVALID_TRANSFORM)
+		TransformSystem::getInstance().Release(this);
+}
+
+void GameObject::Capture(EntityRecord& record) const
 {
-	//std::cout << name << " update" << std::endl;
+	memset(&record, 0, sizeof(record));
+	record.id = id;
+	record.type = GetType();
+	record.position = position;
+	const EntityDescriptor& type = GetDescriptor();
+	strncpy(record.name, type.name.c_str(), sizeof(record.name) - 1);
+	strncpy(record.texture, TextureCache::PathOf(type.texture), sizeof(record.texture) - 1);
 }
 
-void GameObject::draw()
+void GameObject::Restore(const EntityRecord& record)
 {
+	id = record.id;
+	position = record.position;
+	const EntityDescriptor& type = GetDescriptor();
+	Texture2D texture = type.texture;
+	if (record.texture[0] != '\0' && strcmp(TextureCache::PathOf(texture), record.texture) != 0)
+		texture = TextureCache::Load(record.texture);
+	if (type.name != record.name || type.texture.id != texture.id)
+		SetDescriptor(record.name, texture);
+}
+void GameObject::update()
+{
+	//std::cout << GetName() << " update" << std::endl;
+}
 
-	DrawTexture(texture, position.x, position.y, WHITE);
+void GameObject::Emit(RenderSnapshot& snapshot) const
+{
+	const EntityDescriptor& type = GetDescriptor();
+	Rectangle source = { 0, 0, (float)type.texture.width, (float)type.texture.height };
+	SpriteCommand& sprite = snapshot.AddSprite(GetRenderLayer(), GetDepth(), type.texture, source, position);
 
-	if (DisplayName)
+	if (type.displayName && drawNames)
 	{
-		DrawText(name.c_str(), position.x, position.y - 20, 10, YELLOW);
+		strncpy(sprite.label, type.name.c_str(), sizeof(sprite.label) - 1);
 	}
 }
@@ -0,0 +1,46 @@
+#include "GameRandom.h"
+#include <chrono>
+#include <random>
+
+GameRandom* GameRandom::instance = nullptr;
+
+GameRandom::GameRandom()
+{
+	//random_device puede ser determinista en algunas plataformas: se mezcla con el reloj
+	std::random_device device;
+	uint64_t entropy = ((uint64_t)device() << 32) ^ device();
+	Seed(entropy ^ (uint64_t)std::chrono::high_resolution_clock::now().time_since_epoch().count());
+}
+
+void GameRandom::Seed(uint64_t value)
+{
+	seed = value;
+	//mezclar la semilla (splitmix64) para que semillas parecidas no den secuencias parecidas
+	uint64_t z = value + 0x9E3779B97F4A7C15ull;
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	SetState(z ^ (z >> 31));
+}
+
+uint32_t GameRandom::Next()
+{
+	state ^= state >> 12;
+	state ^= state << 25;
+	state ^= state >> 27;
+	return (uint32_t)((state * 0x2545F4914F6CDD1Dull) >> 32);
+}
+
+int GameRandom::Range(int min, int max)
+{
+	if (max <= min)
+		return min;
+	uint32_t span = (uint32_t)(max - min) + 1;
+	return min + (int)(Next() % span);
+}
+
+float GameRandom::Range(float min, float max)
+{
+	//24 bits de mantisa: resultado exacto y repetible en cualquier plataforma
+	float t = (float)(Next() >> 8) / 16777216.0f;
+	return min + (max - min) * t;
+}
@@ -0,0 +1,173 @@
+#include "InputSystem.h"
+#include "GameRandom.h"
+#include <cmath>
+#include <fstream>
+#include <iostream>
+
+InputSystem* InputSystem::instance = nullptr;
+
+//cabecera del archivo de repeticion, seguida de los ticks comprimidos
+struct ReplayHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint64_t seed;
+	uint32_t tickCount;
+	uint32_t compressedSize;
+};
+static constexpr uint32_t REPLAY_MAGIC = 0x52434445; // "EDCR"
+static constexpr uint32_t REPLAY_VERSION = 1;
+
+//tecla de raylib para cada accion
+static const struct { EInputButton button; int key; } KEY_BINDINGS[] =
+{
+	{ INPUT_LEFT, KEY_A },
+	{ INPUT_RIGHT, KEY_D },
+	{ INPUT_UP, KEY_W },
+	{ INPUT_DOWN, KEY_S },
+	{ INPUT_PICKUP, KEY_I },
+	{ INPUT_INTERACT, KEY_F },
+	{ INPUT_FIRE, KEY_SPACE },
+	{ INPUT_NEXT_WEAPON, KEY_TAB },
+	{ INPUT_DEBUG_DAMAGE, KEY_H },
+	{ INPUT_DEBUG_ENERGY, KEY_E },
+	{ INPUT_DEBUG_LEVEL, KEY_L },
+	{ INPUT_QUICK_SAVE, KEY_F5 },
+	{ INPUT_QUICK_LOAD, KEY_F9 },
+	{ INPUT_SNAPSHOT_SAVE, KEY_F6 },
+	{ INPUT_SNAPSHOT_LOAD, KEY_F7 },
+	{ INPUT_REWIND, KEY_BACKSPACE },
+};
+
+static int8_t QuantizeAxis(float value)
+{
+	if (fabsf(value) < 0.2f) // zona muerta del stick
+		return 0;
+	if (value > 1.0f) value = 1.0f;
+	if (value < -1.0f) value = -1.0f;
+	return (int8_t)lroundf(value * 127.0f);
+}
+
+void InputSystem::Sample(float deltaTime)
+{
+	state = {};
+	state.deltaTime = deltaTime;
+	for (const auto& binding : KEY_BINDINGS)
+	{
+		if (IsKeyDown(binding.key)) state.held |= binding.button;
+		if (IsKeyPressed(binding.key)) state.pressed |= binding.button;
+	}
+
+	if (IsGamepadAvailable(0))
+	{
+		state.axisX = QuantizeAxis(GetGamepadAxisMovement(0, GAMEPAD_AXIS_LEFT_X));
+		state.axisY = QuantizeAxis(GetGamepadAxisMovement(0, GAMEPAD_AXIS_LEFT_Y));
+	}
+
+	Vector2 mouse = GetMousePosition();
+	state.mouseX = (int16_t)mouse.x;
+	state.mouseY = (int16_t)mouse.y;
+	if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state.mouse |= MOUSE_STATE_DOWN;
+	if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) state.mouse |= MOUSE_STATE_PRESSED;
+	if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) state.mouse |= MOUSE_STATE_RELEASED;
+	state.command = queuedCommand;
+	queuedCommand = INPUT_COMMAND_NONE;
+}
+
+void InputSystem::BeginTick(float deltaTime)
+{
+	if (replaying)
+	{
+		//al terminar la repeticion se queda sin entrada en vez de leer el teclado;
+		//las ordenes de la UI tambien salen de la grabacion
+		queuedCommand = INPUT_COMMAND_NONE;
+		if (tick < replay.size())
+		{
+			state = replay[tick];
+			tick++;
+		}
+		else
+		{
+			state = {};
+			replayFinished = true;
+		}
+		return;
+	}
+
+	Sample(deltaTime);
+	if (recording)
+		replay.push_back(state);
+	tick++;
+}
+
+void InputSystem::StartRecording(const std::string& path, uint64_t seed)
+{
+	Stop();
+	GameRandom::getInstance().Seed(seed);
+	recordPath = path;
+	recordSeed = seed;
+	replay.clear();
+	replay.reserve(60 * 60 * 10); // diez minutos a 60 fps sin realojar
+	tick = 0;
+	recording = true;
+}
+
+bool InputSystem::StartReplay(const std::string& path)
+{
+	Stop();
+	std::ifstream file(path, std::ios::binary);
+	ReplayHeader header = {};
+	if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+		header.magic != REPLAY_MAGIC || header.version != REPLAY_VERSION)
+	{
+		std::cerr << "Repeticion invalida: " << path << std::endl;
+		return false;
+	}
+
+	std::vector<unsigned char> compressed(header.compressedSize);
+	if (!file.read(reinterpret_cast<char*>(compressed.data()), compressed.size()))
+		return false;
+
+	int rawSize = 0;
+	unsigned char* raw = DecompressData(compressed.data(), (int)compressed.size(), &rawSize);
+	if (!raw)
+		return false;
+	if ((size_t)rawSize != (size_t)header.tickCount * sizeof(InputState))
+	{
+		MemFree(raw);
+		return false;
+	}
+	replay.assign(reinterpret_cast<InputState*>(raw), reinterpret_cast<InputState*>(raw) + header.tickCount);
+	MemFree(raw);
+
+	GameRandom::getInstance().Seed(header.seed);
+	tick = 0;
+	replaying = true;
+	replayFinished = false;
+	return true;
+}
+
+void InputSystem::Stop()
+{
+	if (recording && !WriteReplay())
+		std::cerr << "No se pudo escribir la repeticion " << recordPath << std::endl;
+	recording = false;
+	replaying = false;
+	replay.clear();
+}
+
+bool InputSystem::WriteReplay() const
+{
+	int compressedSize = 0;
+	unsigned char* compressed = CompressData(reinterpret_cast<const unsigned char*>(replay.data()),
+		(int)(replay.size() * sizeof(InputState)), &compressedSize);
+	if (!compressed)
+		return false;
+
+	ReplayHeader header = { REPLAY_MAGIC, REPLAY_VERSION, recordSeed, (uint32_t)replay.size(), (uint32_t)compressedSize };
+	std::ofstream file(recordPath, std::ios::binary | std::ios::trunc);
+	bool ok = file.write(reinterpret_cast<const char*>(&header), sizeof(header)) &&
+		file.write(reinterpret_cast<const char*>(compressed), compressedSize);
+	MemFree(compressed);
+	return ok;
+}
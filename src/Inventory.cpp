@@ -1,60 +1,112 @@
 #include "Inventory.h"
 #include "Player.h"
-void Inventory::PickupWeapon(Weapon* weapon, Player* player) {
-auto* newNode = new LLNode<Weapon>(weapon);
-
-if (!head) {
-    head = tail = current = newNode;
-    head->Next = head; // Circular
-    head->Prev = head;
-}
-else {
-    tail->Next = newNode;
-    newNode->Prev = tail;
-    newNode->Next = head;
-    head->Prev = newNode;
-    tail = newNode;
-}
-current = newNode;
-player->SetWeapon(weapon); // Integracin con sistema de armas
-}
-//std::vector<Weapon*> Inventory::GetInventory() const {
-//    std::vector<Weapon*> weapons;
-//    if (!head) return weapons;
-//
-//    LLNode<Weapon>* node = head;
-//    do {
-//        weapons.push_back(node->data);
-//        node = node->Next;
-//    } while (node != head);
-//
-//    return weapons;
-//}
-void Inventory::NextWeapon(Player* player) {
-    if (current && current->Next) {
-        current = current->Next;
-        std::vector<Weapon*> GetInventory();
-        if (IsKeyPressed(KEY_TAB)) { // O la tecla que prefieras
-            player->GetInventory()->NextWeapon(player);
+#include "ItemRegistry.h"
+#include <algorithm>
+
+bool Inventory::PickupWeapon(Weapon* weapon, Player* player) {
+    if (used >= CAPACITY) return false;
+    //cada arma es su propio slot; el item comparte id con las del mismo nombre
+    slots[used] = { ItemRegistry::getInstance().Register(weapon->GetName()), 1, weapon };
+    current = used++;
+    player->SetWeapon(weapon); // Integracin con sistema de armas
+    return true;
+}
+
+bool Inventory::AddItem(int itemId, int amount) {
+    int maxStack = ItemRegistry::getInstance().GetMaxStack(itemId);
+    //primero llenar los slots que ya tiene, luego abrir nuevos
+    for (int i = 0; i < used && amount > 0; i++) {
+        InventorySlot& slot = slots[i];
+        if (slot.weapon || slot.itemId != itemId || slot.count >= maxStack) continue;
+        int moved = std::min(amount, maxStack - slot.count);
+        slot.count += moved;
+        amount -= moved;
+    }
+    while (amount > 0 && used < CAPACITY) {
+        int moved = std::min(amount, maxStack);
+        slots[used++] = { itemId, moved, nullptr };
+        amount -= moved;
+    }
+    return amount == 0;
+}
+
+bool Inventory::RemoveItem(int itemId, int amount) {
+    if (CountOf(itemId) < amount) return false;
+    //desde el final para no mover slots que todavia se van a revisar
+    for (int i = used - 1; i >= 0 && amount > 0; i--) {
+        InventorySlot& slot = slots[i];
+        if (slot.weapon || slot.itemId != itemId) continue;
+        int taken = std::min(amount, slot.count);
+        slot.count -= taken;
+        amount -= taken;
+        if (slot.count == 0) RemoveSlot(i);
+    }
+    return true;
+}
+
+int Inventory::CountOf(int itemId) const {
+    //las armas tienen item pero no se apilan: solo cuentan los slots de items
+    int total = 0;
+    for (const InventorySlot& slot : *this)
+        if (!slot.weapon && slot.itemId == itemId) total += slot.count;
+    return total;
+}
+
+void Inventory::RemoveSlot(int index) {
+    //se recorre el resto para que los slots sigan juntos
+    for (int i = index; i < used - 1; i++)
+        slots[i] = slots[i + 1];
+    slots[--used] = {};
+    if (current > index) current--;
+}
+
+std::vector<Weapon*> Inventory::GetInventory() const {
+    std::vector<Weapon*> weapons;
+    for (const InventorySlot& slot : *this)
+        if (slot.weapon) weapons.push_back(slot.weapon);
+    return weapons;
+}
+
+int Inventory::GetCurrentIndex() const {
+    if (current < 0) return -1;
+    int index = 0;
+    for (int i = 0; i < current; i++)
+        if (slots[i].weapon) index++;
+    return index;
+}
+
+void Inventory::SetCurrentIndex(int index, Player* player) {
+    if (index < 0) return;
+    for (int i = 0; i < used; i++) {
+        if (!slots[i].weapon) continue;
+        if (index-- == 0) {
+            current = i;
+            player->SetWeapon(slots[i].weapon);
+            return;
         }
-        // En tu funcin de renderizado del UI
-        Weapon* currentWeapon = player->GetInventory()->GetCurrentWeapon();
-        if (currentWeapon) {
-            //DrawText(currentWeapon->GetName().c_str(), x, y, fontSize, color);
-            // O mostrar la imagen: 
-            //DrawTexture(currentWeapon->GetTexture(), x, y, color);
+    }
+}
+
+void Inventory::Clear() {
+    for (int i = 0; i < used; i++)
+        slots[i] = {};
+    used = 0;
+    current = -1;
+}
+
+void Inventory::NextWeapon(Player* player) {
+    if (current < 0) return;
+    //siguiente slot con arma, dando la vuelta al final
+    for (int step = 1; step < used; step++) {
+        int i = (current + step) % used;
+        if (slots[i].weapon) {
+            current = i;
+            player->SetWeapon(slots[i].weapon);
+            return;
         }
-        player->SetWeapon(current->data);
     }
 }
 
 Weapon* Inventory::GetCurrentWeapon() const {
-    if (current == nullptr)
-    {
-        return nullptr;
-   }
-   /* else
-    {
-        return current->data;
-    }*/
+    return current >= 0 ? slots[current].weapon : nullptr;
 }
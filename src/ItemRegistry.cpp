@@ -0,0 +1,41 @@
+#include "ItemRegistry.h"
+
+ItemRegistry* ItemRegistry::instance = nullptr;
+
+ItemRegistry::ItemRegistry()
+{
+	items.reserve(64);
+	byId.reserve(64);
+	byName.reserve(64);
+}
+
+int ItemRegistry::Register(const std::string& name, int maxStack)
+{
+	auto it = byName.find(name);
+	if (it != byName.end())
+		return it->second;
+
+	int id = nextId++;
+	byId[id] = items.size();
+	byName[name] = id;
+	items.emplace_back(name, id, maxStack < 1 ? 1 : maxStack);
+	return id;
+}
+
+const Item* ItemRegistry::Find(int id) const
+{
+	auto it = byId.find(id);
+	return it != byId.end() ? &items[it->second] : nullptr;
+}
+
+const Item* ItemRegistry::FindByName(const std::string& name) const
+{
+	auto it = byName.find(name);
+	return it != byName.end() ? Find(it->second) : nullptr;
+}
+
+int ItemRegistry::GetMaxStack(int id) const
+{
+	const Item* item = Find(id);
+	return item ? item->maxStack : 1;
+}
@@ -1,10 +1,42 @@
 #include "Label.h"
+#include <cstdio>
+
+void Label::SetText(const char* newText)
+{
+	if (text == newText)
+		return;
+	text = newText;
+	MarkDirty();
+}
+
+void Label::Bind(const char* _format, int value)
+{
+	format = _format;
+	boundValue = value;
+	char buffer[64];
+	snprintf(buffer, sizeof(buffer), format, value);
+	SetText(buffer);
+}
+
+void Label::SetValue(int value)
+{
+	if (format == nullptr || value == boundValue)
+		return;
+	Bind(format, value);
+}
 
 void Label::update()
 {
 }
 
+void Label::layout()
+{
+	//medir el texto solo cuando cambia, no cada frame
+	rect.width = (float)MeasureText(text.c_str(), fontSize);
+	rect.height = (float)fontSize;
+}
+
 void Label::draw()
 {
-	DrawText(text, rect.x, rect.y, fontSize, BLACK);
-}
\ No newline at end of file
+	DrawText(text.c_str(), rect.x, rect.y, fontSize, color);
+}
@@ -0,0 +1,68 @@
+#include "LoadMenu.h"
+#include "UISystem.h"
+
+void LoadMenu::Open()
+{
+	if (open)
+		Close();
+	slots = SaveIndex::List();
+	thumbnails.assign(slots.size(), Texture2D{ 0 });
+	//la lista se muestra ya; las miniaturas llegan en los siguientes frames
+	size_t next = 0;
+	thumbnailTask = TaskScheduler::getInstance().Submit([this, next]() mutable {
+		if (next < slots.size())
+		{
+			thumbnails[next] = SaveIndex::LoadThumbnailTexture(slots[next]);
+			next++;
+		}
+		return next >= slots.size();
+	}, TASK_NORMAL, "thumbnails");
+	open = true;
+}
+
+void LoadMenu::Close()
+{
+	TaskScheduler::getInstance().Cancel(thumbnailTask);
+	thumbnailTask = 0;
+	for (Texture2D& texture : thumbnails)
+	{
+		if (texture.id != 0)
+			UnloadTexture(texture);
+	}
+	thumbnails.clear();
+	slots.clear();
+	open = false;
+}
+
+int LoadMenu::update()
+{
+	if (!open)
+		return -1;
+
+	int chosen = -1;
+	for (size_t i = 0; i < slots.size(); i++)
+	{
+		const SaveSlotInfo& info = slots[i];
+		int minutes = (int)(info.playTime / 60.0f);
+		int seconds = (int)info.playTime % 60;
+		const char* text = TextFormat("Slot %i  Era %i  Nivel %i  %02i:%02i", info.slot, info.era, info.level, minutes, seconds);
+		if (UISystem::ImButton(TextFormat("loadSlot%i", info.slot), text, ROW_X, ROW_Y + (int)i * ROW_HEIGHT, 440, ROW_HEIGHT - 4, DARKBLUE))
+			chosen = info.slot;
+	}
+	if (UISystem::ImButton("loadClose", "Cerrar", ROW_X, ROW_Y + (int)slots.size() * ROW_HEIGHT, 440, ROW_HEIGHT - 4, MAROON))
+		Close();
+	return chosen;
+}
+
+void LoadMenu::draw()
+{
+	if (!open)
+		return;
+
+	DrawText(slots.empty() ? "No hay partidas guardadas" : "Cargar partida", ROW_X, ROW_Y - 40, 30, WHITE);
+	for (size_t i = 0; i < thumbnails.size(); i++)
+	{
+		if (thumbnails[i].id != 0)
+			DrawTexture(thumbnails[i], ROW_X - SaveSlotInfo::THUMB_WIDTH - 8, ROW_Y + (int)i * ROW_HEIGHT, WHITE);
+	}
+}
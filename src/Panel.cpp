@@ -0,0 +1,86 @@
+#include "Panel.h"
+
+Panel::~Panel()
+{
+	if (cache.id != 0)
+		UnloadRenderTexture(cache);
+}
+
+void Panel::AddChild(View* child)
+{
+	child->parent = this;
+	children.push_back(child);
+	MarkDirty();
+}
+
+void Panel::update()
+{
+	for (View* child : children)
+	{
+		if (child->visible)
+			child->update();
+	}
+}
+
+void Panel::layout()
+{
+	//layout de los hijos y el rectangulo que los contiene
+	float right = rect.x;
+	float bottom = rect.y;
+	for (View* child : children)
+	{
+		child->Refresh();
+		if (!child->visible)
+			continue;
+		if (child->rect.x + child->rect.width > right)
+			right = child->rect.x + child->rect.width;
+		if (child->rect.y + child->rect.height > bottom)
+			bottom = child->rect.y + child->rect.height;
+	}
+	rect.width = right - rect.x + padding;
+	rect.height = bottom - rect.y + padding;
+
+	renderCache();
+}
+
+void Panel::renderCache()
+{
+	int w = (int)rect.width;
+	int h = (int)rect.height;
+	if (w <= 0 || h <= 0)
+		return;
+
+	//solo se recrea la textura si cambio de tamano
+	if (cache.id == 0 || cache.texture.width != w || cache.texture.height != h)
+	{
+		if (cache.id != 0)
+			UnloadRenderTexture(cache);
+		cache = LoadRenderTexture(w, h);
+	}
+
+	//los hijos estan en coordenadas de pantalla, la camara los mueve al origen de la textura
+	Camera2D camera = { 0 };
+	camera.target = { rect.x, rect.y };
+	camera.zoom = 1.0f;
+
+	BeginTextureMode(cache);
+	ClearBackground(background);
+	BeginMode2D(camera);
+	for (View* child : children)
+	{
+		if (child->visible)
+			child->draw();
+	}
+	EndMode2D();
+	EndTextureMode();
+	redrawCount++;
+}
+
+void Panel::draw()
+{
+	if (cache.id == 0)
+		return;
+	//las render textures de OpenGL estan invertidas en Y
+	Rectangle source = { 0, 0, (float)cache.texture.width, -(float)cache.texture.height };
+	DrawTextureRec(cache.texture, source, { rect.x, rect.y }, WHITE);
+}
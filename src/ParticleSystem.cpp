@@ -0,0 +1,233 @@
+#include "ParticleSystem.h"
+#include "RenderSnapshot.h"
+#include "Simd.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <new>
+
+ParticleSystem* ParticleSystem::instance = nullptr;
+
+static constexpr std::align_val_t SIMD_ALIGNMENT{ 32 };
+
+static float* AllocateLanes(size_t count)
+{
+	float* lanes = static_cast<float*>(::operator new(count * sizeof(float), SIMD_ALIGNMENT));
+	memset(lanes, 0, count * sizeof(float));
+	return lanes;
+}
+
+EmitterId ParticleSystem::AddEmitter(const std::string& name, const EmitterDesc& desc)
+{
+	EmitterId existing = Find(name);
+	if (existing != INVALID_EMITTER)
+		return existing;
+
+	//el pool se reserva una vez; los carriles de relleno quedan en cero
+	Emitter emitter = {};
+	emitter.name = name;
+	emitter.desc = desc;
+	emitter.capacity = ((size_t)std::max(desc.capacity, 1) + LANES - 1) / LANES * LANES;
+	emitter.posX = AllocateLanes(emitter.capacity);
+	emitter.posY = AllocateLanes(emitter.capacity);
+	emitter.velX = AllocateLanes(emitter.capacity);
+	emitter.velY = AllocateLanes(emitter.capacity);
+	emitter.life = AllocateLanes(emitter.capacity);
+	emitter.invLife = AllocateLanes(emitter.capacity);
+	emitter.fade = AllocateLanes(emitter.capacity);
+	emitter.deadMask = new uint8_t[emitter.capacity / LANES]();
+	emitters.push_back(emitter);
+	return (EmitterId)(emitters.size() - 1);
+}
+
+EmitterId ParticleSystem::Find(const std::string& name) const
+{
+	for (size_t i = 0; i < emitters.size(); i++)
+	{
+		if (emitters[i].name == name)
+			return (EmitterId)i;
+	}
+	return INVALID_EMITTER;
+}
+
+float ParticleSystem::RandomRange(float min, float max)
+{
+	//xorshift32: barato y aparte de GameRandom
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 17;
+	randomState ^= randomState << 5;
+	return min + (max - min) * (randomState >> 8) * (1.0f / 16777216.0f);
+}
+
+void ParticleSystem::Burst(EmitterId id, Vector2 position, int count)
+{
+	if (id >= emitters.size())
+		return;
+	Emitter& emitter = emitters[id];
+	const EmitterDesc& desc = emitter.desc;
+	if (count < 0)
+		count = desc.burst;
+
+	int allowed = std::min(count, std::max(budget - liveCount, 0));
+	allowed = std::min(allowed, (int)(emitter.capacity - emitter.count));
+	dropped += count - allowed;
+
+	for (int n = 0; n < allowed; n++)
+	{
+		size_t i = emitter.count++;
+		float angle = RandomRange(0.0f, 2.0f * PI);
+		float speed = RandomRange(desc.minSpeed, desc.maxSpeed);
+		float life = RandomRange(desc.minLife, desc.maxLife);
+		emitter.posX[i] = position.x;
+		emitter.posY[i] = position.y;
+		emitter.velX[i] = cosf(angle) * speed;
+		emitter.velY[i] = sinf(angle) * speed;
+		emitter.life[i] = life;
+		emitter.invLife[i] = life > 0 ? 1.0f / life : 0.0f;
+		emitter.fade[i] = 1.0f;
+	}
+	liveCount += allowed;
+}
+
+void ParticleSystem::Update(float deltaTime)
+{
+	droppedLastFrame = dropped;
+	dropped = 0;
+	liveCount = 0;
+	for (Emitter& emitter : emitters)
+	{
+		if (emitter.count > 0)
+			UpdateEmitter(emitter, deltaTime);
+		liveCount += (int)emitter.count;
+	}
+}
+
+void ParticleSystem::UpdateEmitter(Emitter& emitter, float deltaTime)
+{
+	size_t blocks = (emitter.count + LANES - 1) / LANES;
+	float gravityStep = emitter.desc.gravity * deltaTime;
+
+#if defined(SIMD_AVX)
+	const __m256 dt = _mm256_set1_ps(deltaTime);
+	const __m256 gravity = _mm256_set1_ps(gravityStep);
+	const __m256 zero = _mm256_setzero_ps();
+	for (size_t b = 0; b < blocks; b++)
+	{
+		size_t i = b * LANES;
+		__m256 vy = _mm256_load_ps(emitter.velY + i);
+		__m256 x = _mm256_add_ps(_mm256_load_ps(emitter.posX + i), _mm256_mul_ps(_mm256_load_ps(emitter.velX + i), dt));
+		__m256 y = _mm256_add_ps(_mm256_load_ps(emitter.posY + i), _mm256_mul_ps(vy, dt));
+		__m256 l = _mm256_sub_ps(_mm256_load_ps(emitter.life + i), dt);
+		_mm256_store_ps(emitter.posX + i, x);
+		_mm256_store_ps(emitter.posY + i, y);
+		_mm256_store_ps(emitter.velY + i, _mm256_add_ps(vy, gravity));
+		_mm256_store_ps(emitter.life + i, l);
+		_mm256_store_ps(emitter.fade + i, _mm256_mul_ps(l, _mm256_load_ps(emitter.invLife + i)));
+		emitter.deadMask[b] = (uint8_t)_mm256_movemask_ps(_mm256_cmp_ps(l, zero, _CMP_LE_OQ));
+	}
+#elif defined(SIMD_SSE2)
+	const __m128 dt = _mm_set1_ps(deltaTime);
+	const __m128 gravity = _mm_set1_ps(gravityStep);
+	const __m128 zero = _mm_setzero_ps();
+	for (size_t b = 0; b < blocks; b++)
+	{
+		int mask = 0;
+		for (size_t half = 0; half < 2; half++)
+		{
+			size_t i = b * LANES + half * 4;
+			__m128 vy = _mm_load_ps(emitter.velY + i);
+			__m128 x = _mm_add_ps(_mm_load_ps(emitter.posX + i), _mm_mul_ps(_mm_load_ps(emitter.velX + i), dt));
+			__m128 y = _mm_add_ps(_mm_load_ps(emitter.posY + i), _mm_mul_ps(vy, dt));
+			__m128 l = _mm_sub_ps(_mm_load_ps(emitter.life + i), dt);
+			_mm_store_ps(emitter.posX + i, x);
+			_mm_store_ps(emitter.posY + i, y);
+			_mm_store_ps(emitter.velY + i, _mm_add_ps(vy, gravity));
+			_mm_store_ps(emitter.life + i, l);
+			_mm_store_ps(emitter.fade + i, _mm_mul_ps(l, _mm_load_ps(emitter.invLife + i)));
+			mask |= _mm_movemask_ps(_mm_cmple_ps(l, zero)) << (half * 4);
+		}
+		emitter.deadMask[b] = (uint8_t)mask;
+	}
+#else
+	for (size_t b = 0; b < blocks; b++)
+	{
+		uint8_t mask = 0;
+		for (size_t lane = 0; lane < LANES; lane++)
+		{
+			size_t i = b * LANES + lane;
+			emitter.posX[i] += emitter.velX[i] * deltaTime;
+			emitter.posY[i] += emitter.velY[i] * deltaTime;
+			emitter.velY[i] += gravityStep;
+			emitter.life[i] -= deltaTime;
+			emitter.fade[i] = emitter.life[i] * emitter.invLife[i];
+			if (emitter.life[i] <= 0.0f)
+				mask |= (uint8_t)(1u << lane);
+		}
+		emitter.deadMask[b] = mask;
+	}
+#endif
+	//los carriles de relleno no son particulas
+	size_t used = emitter.count % LANES;
+	if (used)
+		emitter.deadMask[blocks - 1] &= (uint8_t)((1u << used) - 1);
+	Compact(emitter);
+}
+
+void ParticleSystem::Compact(Emitter& emitter)
+{
+	float* lanes[] = { emitter.posX, emitter.posY, emitter.velX, emitter.velY, emitter.life, emitter.invLife, emitter.fade };
+	uint8_t* deadMask = emitter.deadMask;
+	size_t i = 0;
+	while (i < emitter.count)
+	{
+		if (i % LANES == 0 && deadMask[i / LANES] == 0)
+		{
+			i += LANES;
+			continue;
+		}
+		if (!(deadMask[i / LANES] & (1 << (i % LANES))))
+		{
+			i++;
+			continue;
+		}
+		//swap-remove: la ultima (con su marca) pasa a este lugar y se revisa otra vez
+		size_t last = --emitter.count;
+		for (float* lane : lanes)
+			lane[i] = lane[last];
+		uint8_t bit = (uint8_t)(1 << (i % LANES));
+		if (deadMask[last / LANES] & (1 << (last % LANES)))
+			deadMask[i / LANES] |= bit;
+		else
+			deadMask[i / LANES] &= (uint8_t)~bit;
+	}
+}
+
+void ParticleSystem::Emit(RenderSnapshot& snapshot) const
+{
+	for (const Emitter& emitter : emitters)
+	{
+		if (emitter.count == 0)
+			continue;
+		const EmitterDesc& desc = emitter.desc;
+		float half = desc.size * 0.5f;
+		snapshot.BeginParticleBatch(desc.texture);
+		for (size_t i = 0; i < emitter.count; i++)
+		{
+			//de endColor (recien muerta) a startColor (recien nacida)
+			float t = emitter.fade[i];
+			Color color = {
+				(unsigned char)(desc.endColor.r + (desc.startColor.r - desc.endColor.r) * t),
+				(unsigned char)(desc.endColor.g + (desc.startColor.g - desc.endColor.g) * t),
+				(unsigned char)(desc.endColor.b + (desc.startColor.b - desc.endColor.b) * t),
+				(unsigned char)(desc.endColor.a + (desc.startColor.a - desc.endColor.a) * t) };
+			snapshot.AddParticle({ emitter.posX[i] - half, emitter.posY[i] - half, desc.size, color });
+		}
+	}
+}
+
+void ParticleSystem::Clear()
+{
+	for (Emitter& emitter : emitters)
+		emitter.count = 0;
+	liveCount = 0;
+}
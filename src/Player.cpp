@@ -1,4 +1,8 @@
 #include "Player.h"
+#include "InputSystem.h"
+#include "PrefabDatabase.h"
+#include "RenderSnapshot.h"
+#include "ParticleSystem.h"
 
 using namespace Quetz_LabEDC;
 
@@ -9,74 +13,88 @@ void Quetz_LabEDC::Player::start()
 	position = { (float)GetScreenWidth() / 2, (float)GetScreenHeight() / 2 };
 }
 
+void Quetz_LabEDC::Player::InitAnimation()
+{
+	//4 frames por fila, 0.1 s cada uno (antes: 6 frames de juego a 60 fps)
+	static const char* CLIP_NAMES[4] = { "boy_down", "boy_up", "boy_left", "boy_right" };
+	AnimationSystem& animation = AnimationSystem::getInstance();
+	for (int dir = 0; dir < 4; dir++)
+		animData.clips[dir] = animation.AddGridClip(CLIP_NAMES[dir], GetTexture(), dir, 4,
+			animData.spriteWidth, animData.spriteHeight, 0.1f);
+	animData.animator = animation.Create(animData.clips[animData.direction]);
+}
+
 void Quetz_LabEDC::Player::update()
 {
+	//la entrada y el tiempo vienen del tick, asi una repeticion da lo mismo
+	const InputSystem& input = InputSystem::getInstance();
+	float deltaTime = input.GetDeltaTime();
 	Vector2 newpos;
 
 	newpos = position;
 	//position = { (float)GetScreenWidth() / 2, (float)GetScreenHeight() / 2 };
-	if (IsKeyDown(KEY_I))
+	if (input.IsDown(INPUT_PICKUP))
 	{
 		
-		inventory->PickupWeapon(new Weapon({ 0,0 }, "Espada", LoadTexture("Espada.png")), this);
+		Weapon* newWeapon = static_cast<Weapon*>(PrefabDatabase::getInstance().Spawn("Espada"));
+		if (newWeapon && !inventory->PickupWeapon(newWeapon, this))
+			delete newWeapon; //inventario lleno
 		//inventory->PickupWeapon(new Weapon({ 0,0 }, "Arco", LoadTexture("Arco.png")), this);
 		//inventory->PickupWeapon(new Weapon({ 0,0 }, "Bomba", LoadTexture("Bomba.png")), this);
 	}
-	if (IsKeyDown(KEY_A))
+	if (input.IsDown(INPUT_LEFT))
 	{
-		newpos.x -= speed * GetFrameTime();
+		newpos.x -= speed * deltaTime;
 		if (newpos.x < scrollBorder)
 		{
 			newpos.x = scrollBorder;
-			CameraOffset.x -= speed * GetFrameTime();
+			CameraOffset.x -= speed * deltaTime;
 		}
 		animData.direction = ANIM_LEFT;
 	}
-	if (IsKeyDown(KEY_D))
+	if (input.IsDown(INPUT_RIGHT))
 	{
-		newpos.x += speed * GetFrameTime();
+		newpos.x += speed * deltaTime;
 		if (newpos.x > GetScreenWidth() - scrollBorder)
 		{
 			newpos.x = GetScreenWidth() - scrollBorder;
-			CameraOffset.x += speed * GetFrameTime();
+			CameraOffset.x += speed * deltaTime;
 		}
 		animData.direction = ANIM_RIGHT;
 	}
-	if (IsKeyDown(KEY_W))
+	if (input.IsDown(INPUT_UP))
 	{
-		newpos.y -= speed * GetFrameTime();
+		newpos.y -= speed * deltaTime;
 		if (newpos.y < scrollBorder)
 		{
 			newpos.y = scrollBorder;
-			CameraOffset.y -=  speed * GetFrameTime();
+			CameraOffset.y -=  speed * deltaTime;
 		}
 		animData.direction = ANIM_UP;
 	}
-	if (IsKeyDown(KEY_S))
+	if (input.IsDown(INPUT_DOWN))
 	{
-		newpos.y += speed * GetFrameTime();
+		newpos.y += speed * deltaTime;
 		if (newpos.y > GetScreenHeight() - scrollBorder)
 		{
 			newpos.y = scrollBorder;
-			CameraOffset.y += speed * GetFrameTime();
+			CameraOffset.y += speed * deltaTime;
 		}
 		animData.direction = ANIM_DOWN;
 
 	}
 
-	if (IsGamepadAvailable(0)) {
-		float axisX = GetGamepadAxisMovement(0, GAMEPAD_AXIS_LEFT_X);
-		float axisY = GetGamepadAxisMovement(0, GAMEPAD_AXIS_LEFT_Y);
+	//el stick ya viene con la zona muerta aplicada
+	Vector2 axis = input.GetAxis();
 
-		if (fabs(axisX) > 0.2f) { // Umbral para evitar movimiento no intencionado
-			newpos.x += axisX * speed * GetFrameTime();
-			animData.direction = (axisX < 0) ? ANIM_LEFT : ANIM_RIGHT;
-		}
+	if (axis.x != 0.0f) {
+		newpos.x += axis.x * speed * deltaTime;
+		animData.direction = (axis.x < 0) ? ANIM_LEFT : ANIM_RIGHT;
+	}
 
-		if (fabs(axisY) > 0.2f) {
-			newpos.y += axisY * speed * GetFrameTime();
-			animData.direction = (axisY < 0) ? ANIM_UP : ANIM_DOWN;
-		}
+	if (axis.y != 0.0f) {
+		newpos.y += axis.y * speed * deltaTime;
+		animData.direction = (axis.y < 0) ? ANIM_UP : ANIM_DOWN;
 	}
 
 
@@ -85,26 +103,13 @@ void Quetz_LabEDC::Player::update()
 		position = newpos; //solo mover si no hay colision
 	}
 
-	////calcular el frame de la animacion
-	animData.frameCounter++;
-	if (animData.frameCounter > animData.frameSpeed)
-	{
-		animData.frameCounter = 0;
-		animData.currentFrame++;
-
-		if (animData.currentFrame >= animData.maxFrames)
-			animData.currentFrame = 0;
+	//el frame lo avanza AnimationSystem::Step; aqui solo se elige el clip
+	AnimationSystem::getInstance().Play(animData.animator, animData.clips[animData.direction]);
 
-		//std::cout << "Frame: " << animData.currentFrame << std::endl;
-	}
+	if (input.IsPressed(INPUT_NEXT_WEAPON))
+		inventory->NextWeapon(this);
 
-	//si tiene arma, hacer que se mueva con el jugador
-	
-	if (inventory != nullptr && inventory->GetCurrentWeapon() != nullptr)
-	{
-		Weapon* w = inventory->GetCurrentWeapon();
-		w->position = Vector2Add(position, w->offset);
-	}
+	//el arma equipada sigue al jugador por la jerarquia (ver SetWeapon)
 
 	//detectar colisiones con armas tiradas en el suelo
 	for (GameObject* obj : GameObject::gameObjects)
@@ -118,9 +123,10 @@ void Quetz_LabEDC::Player::update()
 			//SetWeapon(w); //cambiar el arma del jugador
 			shouldPromptForWeapon = true; //mostrar mensaje de recoger arma
 
-			if (IsKeyPressed(KEY_F)) //si se presiona F
+			if (input.IsPressed(INPUT_INTERACT)) //si se presiona F
 			{
 				SetWeapon(w); //cambiar el arma del jugador
+				ParticleSystem::getInstance().Burst("recoger", { w->position.x + 32, w->position.y + 32 });
 				shouldPromptForWeapon = false;
 			}
 			break;
@@ -134,19 +140,34 @@ void Quetz_LabEDC::Player::update()
 
 
 
-void Quetz_LabEDC::Player::draw()
+void Quetz_LabEDC::Player::Emit(RenderSnapshot& snapshot) const
 {
-	Rectangle r = { animData.spriteWidth * animData.currentFrame ,
-					animData.spriteHeight * animData.direction,
-					animData.spriteWidth,
-					animData.spriteHeight };
-	DrawTextureRec(texture, r, position, WHITE);
+	AnimationSystem& animation = AnimationSystem::getInstance();
+	snapshot.AddSprite(GetRenderLayer(), GetDepth(), animation.GetSheet(animData.animator),
+		animation.GetFrameRect(animData.animator), position);
 
 	if (shouldPromptForWeapon)
-		DrawText(weaponPrompt, 20, GetScreenHeight() - 40, 20, YELLOW);
+		snapshot.prompt = weaponPrompt;
 	//DrawTexture(texture, position.x, position.y, WHITE);
 }
 
+void Player::Capture(EntityRecord& record) const
+{
+	GameObject::Capture(record);
+	record.speed = speed;
+	record.vector = CameraOffset;
+	record.extra = animData.direction;
+}
+
+void Player::Restore(const EntityRecord& record)
+{
+	GameObject::Restore(record);
+	speed = record.speed;
+	CameraOffset = record.vector;
+	animData.direction = (EAnimDirection)record.extra;
+	AnimationSystem::getInstance().Play(animData.animator, animData.clips[animData.direction]);
+}
+
 void Player::Fire()
 {
 	//checar qe el player tiene un IAttacker y 
@@ -157,12 +178,17 @@ IAttacker* Player::SetWeapon(IAttacker* newWeapon)
 {
 	if (newWeapon)
 	{
+		//la anterior se queda donde esta
+		if (Weapon* previous = dynamic_cast<Weapon*>(weapon))
+			if (previous != newWeapon)
+				TransformSystem::getInstance().Detach(previous);
 		weapon = newWeapon;
 		Weapon* w = dynamic_cast<Weapon*>(weapon);
 		if (w)
 		{
 			w->owner = this; //asignar el owner al arma
-			std::cout << "cambiando arma a " << w->name << std::endl;
+			TransformSystem::getInstance().Attach(w, this, w->offset);
+			std::cout << "cambiando arma a " << w->GetName() << std::endl;
 		}
 
 		//notificar a los sidekicks
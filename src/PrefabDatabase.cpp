@@ -0,0 +1,236 @@
+#include "PrefabDatabase.h"
+#include "SaveManager.h"
+#include "ItemRegistry.h"
+#include "Player.h"
+#include "Enemy.h"
+#include "TextureCache.h"
+#include "EntityDescriptor.h"
+#include "ProjectileSystem.h"
+#include "json.hpp"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+using namespace Quetz_LabEDC;
+using json = nlohmann::json;
+
+PrefabDatabase* PrefabDatabase::instance = nullptr;
+
+struct PrefabCacheHeader
+{
+	uint32_t magic;
+	uint32_t recordSize; //si cambia EntityRecord el cache ya no sirve
+	uint64_t sourceHash;
+	uint32_t itemCount;
+	uint32_t prefabCount;
+};
+static constexpr uint32_t PREFAB_CACHE_MAGIC = 0x50434445; // "EDCP"
+
+// hash FNV-1a de 64 bits del JSON fuente
+static uint64_t HashSource(const std::string& text)
+{
+	uint64_t hash = 14695981039346656037ull;
+	for (unsigned char c : text)
+	{
+		hash ^= c;
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+static bool ParseType(const std::string& type, EntityType& out)
+{
+	static const struct { const char* name; EntityType type; } TYPES[] =
+	{
+		{ "GameObject", EntityType::GameObject },
+		{ "Player", EntityType::Player },
+		{ "Weapon", EntityType::Weapon },
+		{ "SideKick", EntityType::SideKick },
+		{ "Enemy", EntityType::Enemy },
+		{ "Projectile", EntityType::Projectile },
+	};
+	for (const auto& entry : TYPES)
+	{
+		if (type == entry.name)
+		{
+			out = entry.type;
+			return true;
+		}
+	}
+	return false;
+}
+
+static Vector2 ReadVector(const json& value, Vector2 fallback)
+{
+	if (!value.is_array() || value.size() != 2)
+		return fallback;
+	return { value[0].get<float>(), value[1].get<float>() };
+}
+
+bool PrefabDatabase::ParseJson(const std::string& text)
+{
+	json data = json::parse(text, nullptr, false);
+	if (data.is_discarded())
+	{
+		std::cerr << "Prefabs: JSON invalido" << std::endl;
+		return false;
+	}
+
+	items.clear();
+	for (const json& item : data.value("items", json::array()))
+	{
+		ItemEntry entry = {};
+		strncpy(entry.name, item.value("name", "").c_str(), sizeof(entry.name) - 1);
+		entry.maxStack = item.value("maxStack", 1);
+		items.push_back(entry);
+	}
+
+	templates.clear();
+	for (const json& prefab : data.value("prefabs", json::array()))
+	{
+		EntityRecord record;
+		memset(&record, 0, sizeof(record));
+		std::string type = prefab.value("type", "GameObject");
+		if (!ParseType(type, record.type))
+		{
+			std::cerr << "Prefabs: tipo desconocido " << type << std::endl;
+			return false;
+		}
+		strncpy(record.name, prefab.value("name", "").c_str(), sizeof(record.name) - 1);
+		if (prefab.value("displayName", false))
+			record.flags |= ENTITY_DISPLAY_NAME;
+
+		//componentes: cada uno llena los campos del registro que le tocan
+		json components = prefab.value("components", json::object());
+		if (components.contains("transform"))
+			record.position = ReadVector(components["transform"].value("position", json()), { 0, 0 });
+		if (components.contains("sprite"))
+			strncpy(record.texture, components["sprite"].value("texture", "").c_str(), sizeof(record.texture) - 1);
+		if (components.contains("movement"))
+		{
+			record.speed = components["movement"].value("speed", 0.0f);
+			record.vector = ReadVector(components["movement"].value("direction", json()), { 0, 0 });
+		}
+		if (components.contains("weapon"))
+			record.vector = ReadVector(components["weapon"].value("offset", json()), { 0, 0 });
+		templates.push_back(record);
+	}
+	return true;
+}
+
+bool PrefabDatabase::ReadCache(const std::string& cachePath, uint64_t sourceHash)
+{
+	std::ifstream file(cachePath, std::ios::binary);
+	PrefabCacheHeader header = {};
+	if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+		return false;
+	if (header.magic != PREFAB_CACHE_MAGIC || header.recordSize != sizeof(EntityRecord) || header.sourceHash != sourceHash)
+		return false;
+
+	//las plantillas ya estan en su forma final: se leen directo al arreglo
+	items.resize(header.itemCount);
+	templates.resize(header.prefabCount);
+	return file.read(reinterpret_cast<char*>(items.data()), items.size() * sizeof(ItemEntry)) &&
+		file.read(reinterpret_cast<char*>(templates.data()), templates.size() * sizeof(EntityRecord));
+}
+
+void PrefabDatabase::WriteCache(const std::string& cachePath, uint64_t sourceHash) const
+{
+	PrefabCacheHeader header = { PREFAB_CACHE_MAGIC, (uint32_t)sizeof(EntityRecord), sourceHash,
+		(uint32_t)items.size(), (uint32_t)templates.size() };
+	std::vector<uint8_t> body(items.size() * sizeof(ItemEntry) + templates.size() * sizeof(EntityRecord));
+	if (!items.empty())
+		memcpy(body.data(), items.data(), items.size() * sizeof(ItemEntry));
+	if (!templates.empty())
+		memcpy(body.data() + items.size() * sizeof(ItemEntry), templates.data(), templates.size() * sizeof(EntityRecord));
+	if (!SaveManager::WriteFileAtomic(cachePath, &header, sizeof(header), body.data(), body.size()))
+		std::cerr << "Prefabs: no se pudo escribir el cache " << cachePath << std::endl;
+}
+
+void PrefabDatabase::Finish()
+{
+	byName.clear();
+	for (size_t i = 0; i < templates.size(); i++)
+	{
+		const EntityRecord& prefab = templates[i];
+		byName[prefab.name] = i;
+		//las estadisticas base van al descriptor compartido del tipo
+		Texture2D texture = prefab.texture[0] ? TextureCache::Load(prefab.texture) : Texture2D{ 0 };
+		uint16_t descriptor = EntityDescriptors::Intern(prefab.name, texture);
+		EntityDescriptors::SetStats(descriptor, prefab.speed, 0, 0, (prefab.flags & ENTITY_DISPLAY_NAME) != 0);
+		//los proyectiles no se crean como objetos: el sistema usa este prefab
+		if (prefab.type == EntityType::Projectile)
+			ProjectileSystem::getInstance().SetPrefab(descriptor, prefab.speed, prefab.vector);
+	}
+	for (const ItemEntry& item : items)
+		ItemRegistry::getInstance().Register(item.name, item.maxStack);
+}
+
+bool PrefabDatabase::Load(const std::string& jsonPath, const std::string& cachePath)
+{
+	std::ifstream file(jsonPath, std::ios::binary);
+	if (!file.is_open())
+	{
+		std::cerr << "Prefabs no encontrados: " << jsonPath << std::endl;
+		return false;
+	}
+	std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	uint64_t sourceHash = HashSource(text);
+
+	fromCache = ReadCache(cachePath, sourceHash);
+	if (!fromCache)
+	{
+		if (!ParseJson(text))
+			return false;
+		WriteCache(cachePath, sourceHash);
+	}
+	Finish();
+	std::cout << "Prefabs: " << templates.size() << (fromCache ? " (cache)" : " (JSON)") << std::endl;
+	return true;
+}
+
+const EntityRecord* PrefabDatabase::Find(const std::string& name) const
+{
+	auto it = byName.find(name);
+	return it != byName.end() ? &templates[it->second] : nullptr;
+}
+
+GameObject* PrefabDatabase::Spawn(const std::string& name, GameObject* owner)
+{
+	const EntityRecord* prefab = Find(name);
+	if (!prefab)
+	{
+		std::cerr << "Prefab desconocido: " << name << std::endl;
+		return nullptr;
+	}
+	return Spawn(name, prefab->position, owner);
+}
+
+GameObject* PrefabDatabase::Spawn(const std::string& name, Vector2 position, GameObject* owner)
+{
+	const EntityRecord* prefab = Find(name);
+	if (!prefab)
+	{
+		std::cerr << "Prefab desconocido: " << name << std::endl;
+		return nullptr;
+	}
+
+	EntityRecord record;
+	memcpy(&record, prefab, sizeof(record));
+	record.position = position;
+
+	//mismo camino que la carga de partidas, con un id nuevo
+	GameObject* obj = SaveManager::CreateFromRecord(record);
+	record.id = obj->id;
+	obj->Restore(record);
+
+	if (owner)
+	{
+		if (sideKick* sk = dynamic_cast<sideKick*>(obj))
+			sk->owner = owner;
+		else if (Enemy* enemy = dynamic_cast<Enemy*>(obj))
+			enemy->target = dynamic_cast<Player*>(owner);
+	}
+	return obj;
+}
@@ -0,0 +1,297 @@
+#include "ProjectileSystem.h"
+#include "EntityDescriptor.h"
+#include "RenderSnapshot.h"
+#include "Simd.h"
+#include <cmath>
+#include <cstring>
+#include <new>
+
+ProjectileSystem* ProjectileSystem::instance = nullptr;
+
+static constexpr std::align_val_t SIMD_ALIGNMENT{ 32 };
+static constexpr size_t INITIAL_CAPACITY = 256;
+
+static float* AllocateLanes(size_t count)
+{
+	return static_cast<float*>(::operator new(count * sizeof(float), SIMD_ALIGNMENT));
+}
+
+static void FreeLanes(float* lanes)
+{
+	::operator delete(lanes, SIMD_ALIGNMENT);
+}
+
+ProjectileSystem::ProjectileSystem()
+	: descriptor(EntityDescriptors::Intern("Projectile", { 0 }))
+{
+	Grow();
+}
+
+void ProjectileSystem::SetPrefab(uint16_t _descriptor, float _speed, Vector2 _direction)
+{
+	descriptor = _descriptor;
+	speed = _speed > 0 ? _speed : DEFAULT_SPEED;
+	direction = _direction;
+}
+
+void ProjectileSystem::Grow()
+{
+	size_t newCapacity = capacity ? capacity * 2 : INITIAL_CAPACITY;
+	float** lanes[] = { &posX, &posY, &velX, &velY, &life };
+	for (float** lane : lanes)
+	{
+		//los carriles de relleno quedan en cero: el kernel los lee pero no cuentan
+		float* grown = AllocateLanes(newCapacity);
+		memset(grown, 0, newCapacity * sizeof(float));
+		if (*lane)
+		{
+			memcpy(grown, *lane, count * sizeof(float));
+			FreeLanes(*lane);
+		}
+		*lane = grown;
+	}
+	delete[] deadMask;
+	deadMask = new uint8_t[newCapacity / LANES]();
+	capacity = newCapacity;
+}
+
+void ProjectileSystem::Push(Vector2 position, Vector2 velocity, float lifetime)
+{
+	if (count == capacity)
+		Grow();
+	posX[count] = position.x;
+	posY[count] = position.y;
+	velX[count] = velocity.x;
+	velY[count] = velocity.y;
+	life[count] = lifetime;
+	count++;
+}
+
+bool ProjectileSystem::Spawn(Vector2 position, Vector2 velocity, float lifetime)
+{
+	if ((int)count >= maxCount)
+		return false;
+	Push(position, velocity, lifetime);
+	return true;
+}
+
+bool ProjectileSystem::Fire(Vector2 position)
+{
+	return Spawn(position, { direction.x * speed, direction.y * speed });
+}
+
+uint8_t ProjectileSystem::TailMask() const
+{
+	size_t used = count % LANES;
+	return used ? (uint8_t)((1u << used) - 1) : 0xFF;
+}
+
+void ProjectileSystem::Update(float deltaTime, Rectangle bounds)
+{
+	size_t blocks = (count + LANES - 1) / LANES;
+	if (blocks == 0)
+		return;
+
+#if defined(SIMD_AVX)
+	const __m256 dt = _mm256_set1_ps(deltaTime);
+	const __m256 minX = _mm256_set1_ps(bounds.x), maxX = _mm256_set1_ps(bounds.x + bounds.width);
+	const __m256 minY = _mm256_set1_ps(bounds.y), maxY = _mm256_set1_ps(bounds.y + bounds.height);
+	const __m256 zero = _mm256_setzero_ps();
+	for (size_t b = 0; b < blocks; b++)
+	{
+		size_t i = b * LANES;
+		__m256 x = _mm256_add_ps(_mm256_load_ps(posX + i), _mm256_mul_ps(_mm256_load_ps(velX + i), dt));
+		__m256 y = _mm256_add_ps(_mm256_load_ps(posY + i), _mm256_mul_ps(_mm256_load_ps(velY + i), dt));
+		__m256 l = _mm256_sub_ps(_mm256_load_ps(life + i), dt);
+		_mm256_store_ps(posX + i, x);
+		_mm256_store_ps(posY + i, y);
+		_mm256_store_ps(life + i, l);
+		__m256 out = _mm256_or_ps(_mm256_cmp_ps(x, minX, _CMP_LT_OQ), _mm256_cmp_ps(x, maxX, _CMP_GT_OQ));
+		out = _mm256_or_ps(out, _mm256_or_ps(_mm256_cmp_ps(y, minY, _CMP_LT_OQ), _mm256_cmp_ps(y, maxY, _CMP_GT_OQ)));
+		out = _mm256_or_ps(out, _mm256_cmp_ps(l, zero, _CMP_LE_OQ));
+		deadMask[b] = (uint8_t)_mm256_movemask_ps(out);
+	}
+#elif defined(SIMD_SSE2)
+	const __m128 dt = _mm_set1_ps(deltaTime);
+	const __m128 minX = _mm_set1_ps(bounds.x), maxX = _mm_set1_ps(bounds.x + bounds.width);
+	const __m128 minY = _mm_set1_ps(bounds.y), maxY = _mm_set1_ps(bounds.y + bounds.height);
+	const __m128 zero = _mm_setzero_ps();
+	for (size_t b = 0; b < blocks; b++)
+	{
+		int mask = 0;
+		//dos mitades de 4 por bloque de 8
+		for (size_t half = 0; half < 2; half++)
+		{
+			size_t i = b * LANES + half * 4;
+			__m128 x = _mm_add_ps(_mm_load_ps(posX + i), _mm_mul_ps(_mm_load_ps(velX + i), dt));
+			__m128 y = _mm_add_ps(_mm_load_ps(posY + i), _mm_mul_ps(_mm_load_ps(velY + i), dt));
+			__m128 l = _mm_sub_ps(_mm_load_ps(life + i), dt);
+			_mm_store_ps(posX + i, x);
+			_mm_store_ps(posY + i, y);
+			_mm_store_ps(life + i, l);
+			__m128 out = _mm_or_ps(_mm_cmplt_ps(x, minX), _mm_cmpgt_ps(x, maxX));
+			out = _mm_or_ps(out, _mm_or_ps(_mm_cmplt_ps(y, minY), _mm_cmpgt_ps(y, maxY)));
+			out = _mm_or_ps(out, _mm_cmple_ps(l, zero));
+			mask |= _mm_movemask_ps(out) << (half * 4);
+		}
+		deadMask[b] = (uint8_t)mask;
+	}
+#else
+	float maxX = bounds.x + bounds.width;
+	float maxY = bounds.y + bounds.height;
+	for (size_t b = 0; b < blocks; b++)
+	{
+		uint8_t mask = 0;
+		for (size_t lane = 0; lane < LANES; lane++)
+		{
+			size_t i = b * LANES + lane;
+			posX[i] += velX[i] * deltaTime;
+			posY[i] += velY[i] * deltaTime;
+			life[i] -= deltaTime;
+			if (posX[i] < bounds.x || posX[i] > maxX || posY[i] < bounds.y || posY[i] > maxY || life[i] <= 0.0f)
+				mask |= (uint8_t)(1u << lane);
+		}
+		deadMask[b] = mask;
+	}
+#endif
+	//los carriles de relleno no son proyectiles
+	deadMask[blocks - 1] &= TailMask();
+	Compact();
+}
+
+const std::vector<ProjectileHit>& ProjectileSystem::Collide(const Rectangle* boxes, int boxCount)
+{
+	hits.clear();
+	size_t blocks = (count + LANES - 1) / LANES;
+	if (blocks == 0 || boxCount <= 0)
+		return hits;
+	memset(deadMask, 0, blocks);
+
+	//el proyectil cuenta con el tamano de su sprite
+	const EntityDescriptor& type = EntityDescriptors::Get(descriptor);
+	float width = (float)type.texture.width;
+	float height = (float)type.texture.height;
+
+	for (int box = 0; box < boxCount; box++)
+	{
+		//se solapan si x esta en (caja.x - ancho, caja.x + caja.ancho), igual en y
+		const Rectangle& r = boxes[box];
+		float x0 = r.x - width, x1 = r.x + r.width;
+		float y0 = r.y - height, y1 = r.y + r.height;
+#if defined(SIMD_AVX)
+		const __m256 minX = _mm256_set1_ps(x0), maxX = _mm256_set1_ps(x1);
+		const __m256 minY = _mm256_set1_ps(y0), maxY = _mm256_set1_ps(y1);
+#elif defined(SIMD_SSE2)
+		const __m128 minX = _mm_set1_ps(x0), maxX = _mm_set1_ps(x1);
+		const __m128 minY = _mm_set1_ps(y0), maxY = _mm_set1_ps(y1);
+#endif
+		for (size_t b = 0; b < blocks; b++)
+		{
+			size_t first = b * LANES;
+			int mask = 0;
+#if defined(SIMD_AVX)
+			__m256 x = _mm256_load_ps(posX + first);
+			__m256 y = _mm256_load_ps(posY + first);
+			__m256 in = _mm256_and_ps(_mm256_cmp_ps(x, minX, _CMP_GT_OQ), _mm256_cmp_ps(x, maxX, _CMP_LT_OQ));
+			in = _mm256_and_ps(in, _mm256_and_ps(_mm256_cmp_ps(y, minY, _CMP_GT_OQ), _mm256_cmp_ps(y, maxY, _CMP_LT_OQ)));
+			mask = _mm256_movemask_ps(in);
+#elif defined(SIMD_SSE2)
+			for (size_t half = 0; half < 2; half++)
+			{
+				size_t i = first + half * 4;
+				__m128 x = _mm_load_ps(posX + i);
+				__m128 y = _mm_load_ps(posY + i);
+				__m128 in = _mm_and_ps(_mm_cmpgt_ps(x, minX), _mm_cmplt_ps(x, maxX));
+				in = _mm_and_ps(in, _mm_and_ps(_mm_cmpgt_ps(y, minY), _mm_cmplt_ps(y, maxY)));
+				mask |= _mm_movemask_ps(in) << (half * 4);
+			}
+#else
+			for (size_t lane = 0; lane < LANES; lane++)
+			{
+				size_t i = first + lane;
+				if (posX[i] > x0 && posX[i] < x1 && posY[i] > y0 && posY[i] < y1)
+					mask |= 1 << lane;
+			}
+#endif
+			//los que ya pegaron en otra caja de este lote no cuentan otra vez
+			mask &= ~deadMask[b];
+			if (b == blocks - 1)
+				mask &= TailMask();
+			if (mask == 0)
+				continue;
+			deadMask[b] |= (uint8_t)mask;
+			for (size_t lane = 0; lane < LANES; lane++)
+			{
+				if (mask & (1 << lane))
+					hits.push_back({ box, { posX[first + lane], posY[first + lane] } });
+			}
+		}
+	}
+	if (!hits.empty())
+		Compact();
+	return hits;
+}
+
+void ProjectileSystem::Compact()
+{
+	size_t i = 0;
+	while (i < count)
+	{
+		//bloques completos sin marcas se saltan de un jalon
+		if (i % LANES == 0 && deadMask[i / LANES] == 0)
+		{
+			i += LANES;
+			continue;
+		}
+		if (!(deadMask[i / LANES] & (1 << (i % LANES))))
+		{
+			i++;
+			continue;
+		}
+		//swap-remove: el ultimo (con su marca) pasa a este lugar y se revisa otra vez
+		size_t last = --count;
+		posX[i] = posX[last];
+		posY[i] = posY[last];
+		velX[i] = velX[last];
+		velY[i] = velY[last];
+		life[i] = life[last];
+		uint8_t bit = (uint8_t)(1 << (i % LANES));
+		if (deadMask[last / LANES] & (1 << (last % LANES)))
+			deadMask[i / LANES] |= bit;
+		else
+			deadMask[i / LANES] &= (uint8_t)~bit;
+	}
+}
+
+void ProjectileSystem::Emit(RenderSnapshot& snapshot) const
+{
+	const EntityDescriptor& type = EntityDescriptors::Get(descriptor);
+	Rectangle source = { 0, 0, (float)type.texture.width, (float)type.texture.height };
+	for (size_t i = 0; i < count; i++)
+	{
+		snapshot.AddSprite(LAYER_PROJECTILES, posY[i] + source.height, type.texture, source, { posX[i], posY[i] });
+	}
+}
+
+void ProjectileSystem::Capture(size_t index, EntityRecord& record) const
+{
+	memset(&record, 0, sizeof(record));
+	record.type = EntityType::Projectile;
+	record.flags = ENTITY_IN_WORLD;
+	record.position = { posX[index], posY[index] };
+	//direccion unitaria + rapidez en px/s, como en el prefab
+	float length = sqrtf(velX[index] * velX[index] + velY[index] * velY[index]);
+	record.vector = length > 0 ? Vector2{ velX[index] / length, velY[index] / length } : direction;
+	record.speed = length;
+	record.extra = (int32_t)(life[index] * 1000.0f);
+	const EntityDescriptor& type = EntityDescriptors::Get(descriptor);
+	strncpy(record.name, type.name.c_str(), sizeof(record.name) - 1);
+}
+
+void ProjectileSystem::Restore(const EntityRecord& record)
+{
+	float recordSpeed = record.speed > 0 ? record.speed : speed;
+	float lifetime = record.extra > 0 ? record.extra / 1000.0f : DEFAULT_LIFETIME;
+	//al restaurar no aplica el tope: la partida ya los tenia
+	Push(record.position, { record.vector.x * recordSpeed, record.vector.y * recordSpeed }, lifetime);
+}
@@ -0,0 +1,116 @@
+#include "QualityGovernor.h"
+#include "AIScheduler.h"
+#include "AnimationSystem.h"
+#include "ParticleSystem.h"
+#include "ProjectileSystem.h"
+#include "GameObject.h"
+#include <algorithm>
+#include <iostream>
+
+QualityGovernor* QualityGovernor::instance = nullptr;
+
+static const QualitySettings PRESETS[QualityGovernor::LEVEL_COUNT] =
+{
+	//nombre    medio lejos tope  proy. part.  anim  nombres
+	{ "Alta",     4,   16,    0,  200,  4096,  1,   true  },
+	{ "Media",    6,   24,  256,  120,  2048,  1,   true  },
+	{ "Baja",     8,   32,  128,   60,  1024,  2,   false },
+	{ "Minima",  12,   48,   64,   30,   256,  3,   false },
+};
+
+const QualitySettings& QualityGovernor::GetPreset(int level)
+{
+	return PRESETS[std::clamp(level, 0, LEVEL_COUNT - 1)];
+}
+
+void QualityGovernor::Apply()
+{
+	const QualitySettings& settings = GetSettings();
+	AIScheduler::getInstance().SetIntervals(settings.aiMidInterval, settings.aiFarInterval);
+	AIScheduler::getInstance().SetMaxTicksPerFrame(settings.aiMaxTicksPerFrame);
+	AnimationSystem::getInstance().SetStepInterval(settings.animationInterval);
+	ProjectileSystem::getInstance().SetMaxCount(settings.maxProjectiles);
+	ParticleSystem::getInstance().SetBudget(settings.maxParticles);
+	Quetz_LabEDC::GameObject::drawNames = settings.drawNames;
+}
+
+void QualityGovernor::ResetWindow()
+{
+	//los tiempos de antes del cambio ya no dicen nada del nivel nuevo
+	sampleCount = 0;
+	sampleHead = 0;
+	windowFrames = 0;
+	overWindows = 0;
+	underWindows = 0;
+}
+
+void QualityGovernor::SetLevel(int value)
+{
+	value = std::clamp(value, 0, LEVEL_COUNT - 1);
+	if (value == level)
+		return;
+	level = value;
+	levelChanges++;
+	Apply();
+	ResetWindow();
+}
+
+void QualityGovernor::SetAuto(bool enabled)
+{
+	autoMode = enabled;
+	ResetWindow();
+}
+
+void QualityGovernor::SetTargetFps(int fps)
+{
+	targetFps = std::max(fps, 1);
+	ResetWindow();
+}
+
+void QualityGovernor::AddFrame(float workMs)
+{
+	samples[sampleHead] = workMs;
+	sampleHead = (sampleHead + 1) % SAMPLE_COUNT;
+	if (sampleCount < SAMPLE_COUNT)
+		sampleCount++;
+	if (++windowFrames >= WINDOW_FRAMES)
+	{
+		windowFrames = 0;
+		Evaluate();
+	}
+}
+
+float QualityGovernor::GetPercentile(float percentile) const
+{
+	if (sampleCount == 0)
+		return 0.0f;
+	float sorted[SAMPLE_COUNT];
+	std::copy(samples, samples + sampleCount, sorted);
+	int index = std::clamp((int)(percentile / 100.0f * (sampleCount - 1) + 0.5f), 0, sampleCount - 1);
+	std::nth_element(sorted, sorted + index, sorted + sampleCount);
+	return sorted[index];
+}
+
+void QualityGovernor::Evaluate()
+{
+	if (!IsAuto() || sampleCount < WINDOW_FRAMES)
+		return;
+
+	float p95 = GetPercentile(95.0f);
+	float target = GetTargetMs();
+	overWindows = p95 > target * downgradeRatio ? overWindows + 1 : 0;
+	underWindows = p95 < target * upgradeRatio ? underWindows + 1 : 0;
+
+	if (overWindows >= downgradeWindows && level < LEVEL_COUNT - 1)
+	{
+		std::cout << "Calidad: " << GetSettings().name << " -> " << GetPreset(level + 1).name
+			<< " (p95 " << p95 << " ms)" << std::endl;
+		SetLevel(level + 1);
+	}
+	else if (underWindows >= upgradeWindows && level > 0)
+	{
+		std::cout << "Calidad: " << GetSettings().name << " -> " << GetPreset(level - 1).name
+			<< " (p95 " << p95 << " ms)" << std::endl;
+		SetLevel(level - 1);
+	}
+}
@@ -0,0 +1,88 @@
+#include "RenderQueue.h"
+#include "FrameArena.h"
+#include <cstring>
+
+RenderQueue* RenderQueue::instance = nullptr;
+
+static constexpr uint64_t TEXTURE_MASK = 0xFFFFFF;
+
+uint64_t RenderQueue::MakeKey(ERenderLayer layer, float depth, unsigned int textureId)
+{
+	//bits del float volteados para que el orden como entero sea el numerico
+	uint32_t bits;
+	memcpy(&bits, &depth, sizeof(bits));
+	bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+	return ((uint64_t)layer << 56) | ((uint64_t)bits << 24) | (textureId & TEXTURE_MASK);
+}
+
+void RenderQueue::Submit(ERenderLayer layer, float depth, unsigned int textureId, DrawFn draw, void* context)
+{
+	Submit(MakeKey(layer, depth, textureId), draw, context);
+}
+
+void RenderQueue::Submit(uint64_t key, DrawFn draw, void* context)
+{
+	keys.push_back(key);
+	items.push_back({ draw, context });
+}
+
+RenderQueue::SortEntry* RenderQueue::RadixSort(SortEntry* entries, SortEntry* scratch, size_t count)
+{
+	lastPasses = 0;
+	for (int shift = 0; shift < 64; shift += 8)
+	{
+		size_t histogram[256] = {};
+		for (size_t i = 0; i < count; i++)
+			histogram[(entries[i].key >> shift) & 0xFF]++;
+
+		//todos con el mismo byte (capa o textura casi siempre): el paso no cambia nada
+		if (histogram[(entries[0].key >> shift) & 0xFF] == count)
+			continue;
+
+		size_t offset = 0;
+		for (size_t& bucket : histogram)
+		{
+			size_t size = bucket;
+			bucket = offset;
+			offset += size;
+		}
+		for (size_t i = 0; i < count; i++)
+			scratch[histogram[(entries[i].key >> shift) & 0xFF]++] = entries[i];
+
+		SortEntry* swap = entries;
+		entries = scratch;
+		scratch = swap;
+		lastPasses++;
+	}
+	return entries;
+}
+
+void RenderQueue::Flush()
+{
+	size_t count = items.size();
+	lastCount = count;
+	lastTextureSwitches = 0;
+	if (count == 0)
+	{
+		lastPasses = 0;
+		return;
+	}
+
+	FrameArena& arena = FrameArena::getInstance();
+	SortEntry* entries = arena.AllocateArray<SortEntry>(count);
+	SortEntry* scratch = arena.AllocateArray<SortEntry>(count);
+	for (size_t i = 0; i < count; i++)
+		entries[i] = { keys[i], (uint32_t)i };
+
+	SortEntry* sorted = RadixSort(entries, scratch, count);
+	for (size_t i = 0; i < count; i++)
+	{
+		if (i > 0 && (sorted[i].key & TEXTURE_MASK) != (sorted[i - 1].key & TEXTURE_MASK))
+			lastTextureSwitches++;
+		const Item& item = items[sorted[i].item];
+		item.draw(item.context);
+	}
+
+	items.clear();
+	keys.clear();
+}
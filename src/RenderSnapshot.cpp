@@ -0,0 +1,67 @@
+#include "RenderSnapshot.h"
+#include "rlgl.h"
+
+void RenderSnapshot::Clear()
+{
+	sprites.clear();
+	particles.clear();
+	particleBatches.clear();
+	prompt = nullptr;
+	saveSlot = -1;
+}
+
+SpriteCommand& RenderSnapshot::AddSprite(ERenderLayer layer, float depth, Texture2D texture, Rectangle source, Vector2 position)
+{
+	sprites.push_back({ RenderQueue::MakeKey(layer, depth, texture.id), texture, source, position, "" });
+	return sprites.back();
+}
+
+void RenderSnapshot::BeginParticleBatch(Texture2D texture)
+{
+	particleBatches.push_back({ this, texture, (uint32_t)particles.size(), 0 });
+}
+
+void RenderSnapshot::AddParticle(const ParticleVertex& particle)
+{
+	particles.push_back(particle);
+	particleBatches.back().count++;
+}
+
+static void DrawSprite(void* context)
+{
+	const SpriteCommand& sprite = *static_cast<const SpriteCommand*>(context);
+	DrawTextureRec(sprite.texture, sprite.source, sprite.position, WHITE);
+	if (sprite.label[0] != '\0')
+		DrawText(sprite.label, sprite.position.x, sprite.position.y - 20, 10, YELLOW);
+}
+
+//todas las particulas del lote en un solo rlBegin con una textura (rlgl parte el lote si se llena)
+static void DrawParticles(void* context)
+{
+	const ParticleBatch& batch = *static_cast<const ParticleBatch*>(context);
+	const ParticleVertex* particle = batch.owner->particles.data() + batch.first;
+	rlSetTexture(batch.texture.id != 0 ? batch.texture.id : rlGetTextureIdDefault());
+	rlBegin(RL_QUADS);
+	for (uint32_t i = 0; i < batch.count; i++, particle++)
+	{
+		rlColor4ub(particle->color.r, particle->color.g, particle->color.b, particle->color.a);
+		rlTexCoord2f(0.0f, 0.0f);
+		rlVertex2f(particle->x, particle->y);
+		rlTexCoord2f(0.0f, 1.0f);
+		rlVertex2f(particle->x, particle->y + particle->size);
+		rlTexCoord2f(1.0f, 1.0f);
+		rlVertex2f(particle->x + particle->size, particle->y + particle->size);
+		rlTexCoord2f(1.0f, 0.0f);
+		rlVertex2f(particle->x + particle->size, particle->y);
+	}
+	rlEnd();
+	rlSetTexture(0);
+}
+
+void RenderSnapshot::Submit(RenderQueue& queue) const
+{
+	for (const SpriteCommand& sprite : sprites)
+		queue.Submit(sprite.key, DrawSprite, const_cast<SpriteCommand*>(&sprite));
+	for (const ParticleBatch& batch : particleBatches)
+		queue.Submit(RenderQueue::MakeKey(LAYER_EFFECTS, 0.0f, batch.texture.id), DrawParticles, const_cast<ParticleBatch*>(&batch));
+}
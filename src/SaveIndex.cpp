@@ -0,0 +1,151 @@
+#include "SaveIndex.h"
+#include "SaveManager.h"
+#include "rlgl.h"
+#include <cstring>
+#include <ctime>
+#include <mutex>
+
+static const char* INDEX_PATH = "save_index.dat";
+static constexpr uint32_t INDEX_MAGIC = 0x49434445; // "EDCI"
+static constexpr uint32_t INDEX_VERSION = 1;
+static constexpr int COLOR_BUFFER_BIT = 0x4000; //GL_COLOR_BUFFER_BIT (rlgl no lo expone)
+
+//el guardado en segundo plano y el menu pueden tocar el indice a la vez
+static std::mutex indexMutex;
+
+struct IndexHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t slotCount;
+	uint32_t entrySize;
+};
+
+bool SaveIndex::Read(std::vector<SaveSlotInfo>& slots)
+{
+	slots.assign(MAX_SLOTS, SaveSlotInfo());
+	memset(slots.data(), 0, slots.size() * sizeof(SaveSlotInfo));
+
+	std::ifstream file(INDEX_PATH, std::ios::binary);
+	if (!file.is_open())
+		return false;
+
+	IndexHeader header;
+	file.read((char*)&header, sizeof(header));
+	if (!file || header.magic != INDEX_MAGIC || header.version != INDEX_VERSION ||
+		header.entrySize != sizeof(SaveSlotInfo) || header.slotCount != MAX_SLOTS)
+		return false;
+
+	file.read((char*)slots.data(), slots.size() * sizeof(SaveSlotInfo));
+	return (bool)file;
+}
+
+bool SaveIndex::Update(int slot, const WorldState& world)
+{
+	if (slot < 0 || slot >= MAX_SLOTS)
+		return false;
+
+	std::lock_guard<std::mutex> lock(indexMutex);
+	std::vector<SaveSlotInfo> slots;
+	Read(slots);
+
+	SaveSlotInfo& info = slots[slot];
+	info.used = 1;
+	info.slot = slot;
+	info.timestamp = (int64_t)std::time(nullptr);
+	info.era = world.stats.era;
+	info.level = world.stats.level;
+	info.health = world.stats.health;
+	info.playTime = world.stats.playTime;
+	info.hasThumbnail = Shrink(world.thumbnail, info.thumbnail);
+
+	IndexHeader header = { INDEX_MAGIC, INDEX_VERSION, MAX_SLOTS, sizeof(SaveSlotInfo) };
+	return SaveManager::WriteFileAtomic(INDEX_PATH, &header, sizeof(header), slots.data(), slots.size() * sizeof(SaveSlotInfo));
+}
+
+std::vector<SaveSlotInfo> SaveIndex::List()
+{
+	std::vector<SaveSlotInfo> slots;
+	{
+		std::lock_guard<std::mutex> lock(indexMutex);
+		Read(slots);
+	}
+
+	std::vector<SaveSlotInfo> used;
+	for (const SaveSlotInfo& info : slots)
+	{
+		if (info.used)
+			used.push_back(info);
+	}
+	return used;
+}
+
+void SaveIndex::CaptureThumbnail(std::vector<uint8_t>& rgba)
+{
+	static RenderTexture2D capture = { 0 };
+	if (capture.id == 0)
+		capture = LoadRenderTexture(CAPTURE_WIDTH, CAPTURE_HEIGHT);
+
+	//vaciar el lote pendiente para que lo dibujado ya este en el framebuffer
+	rlDrawRenderBatchActive();
+	//la GPU reduce la pantalla a la textura chica; no se lee el framebuffer completo
+	rlBindFramebuffer(RL_READ_FRAMEBUFFER, 0);
+	rlBindFramebuffer(RL_DRAW_FRAMEBUFFER, capture.id);
+	rlBlitFramebuffer(0, 0, GetRenderWidth(), GetRenderHeight(), 0, 0, CAPTURE_WIDTH, CAPTURE_HEIGHT, COLOR_BUFFER_BIT);
+	rlDisableFramebuffer();
+
+	uint8_t* pixels = (uint8_t*)rlReadTexturePixels(capture.texture.id, CAPTURE_WIDTH, CAPTURE_HEIGHT, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+	if (!pixels)
+	{
+		rgba.clear();
+		return;
+	}
+	rgba.assign(pixels, pixels + CAPTURE_WIDTH * CAPTURE_HEIGHT * 4);
+	RL_FREE(pixels);
+}
+
+bool SaveIndex::Shrink(const std::vector<uint8_t>& rgba, uint8_t* rgb)
+{
+	if (rgba.size() != (size_t)CAPTURE_WIDTH * CAPTURE_HEIGHT * 4)
+		return false;
+
+	//promedio de cada bloque CAPTURE_SCALE x CAPTURE_SCALE; las filas de la
+	//textura van de abajo hacia arriba, la miniatura de arriba hacia abajo
+	const int area = CAPTURE_SCALE * CAPTURE_SCALE;
+	for (int y = 0; y < SaveSlotInfo::THUMB_HEIGHT; y++)
+	{
+		for (int x = 0; x < SaveSlotInfo::THUMB_WIDTH; x++)
+		{
+			int sum[3] = { 0, 0, 0 };
+			for (int sy = 0; sy < CAPTURE_SCALE; sy++)
+			{
+				const uint8_t* row = rgba.data() + ((size_t)(CAPTURE_HEIGHT - 1 - (y * CAPTURE_SCALE + sy)) * CAPTURE_WIDTH + x * CAPTURE_SCALE) * 4;
+				for (int sx = 0; sx < CAPTURE_SCALE; sx++, row += 4)
+				{
+					sum[0] += row[0];
+					sum[1] += row[1];
+					sum[2] += row[2];
+				}
+			}
+			uint8_t* out = rgb + ((size_t)y * SaveSlotInfo::THUMB_WIDTH + x) * 3;
+			out[0] = (uint8_t)(sum[0] / area);
+			out[1] = (uint8_t)(sum[1] / area);
+			out[2] = (uint8_t)(sum[2] / area);
+		}
+	}
+	return true;
+}
+
+Texture2D SaveIndex::LoadThumbnailTexture(const SaveSlotInfo& info)
+{
+	if (!info.hasThumbnail)
+		return Texture2D{ 0 };
+
+	Image image = { 0 };
+	image.data = (void*)info.thumbnail;
+	image.width = SaveSlotInfo::THUMB_WIDTH;
+	image.height = SaveSlotInfo::THUMB_HEIGHT;
+	image.mipmaps = 1;
+	image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
+	return LoadTextureFromImage(image);
+}
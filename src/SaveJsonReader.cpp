@@ -0,0 +1,168 @@
+#include "SaveJsonReader.h"
+#include <cstring>
+#include <iostream>
+
+bool SaveJsonReader::start_object(std::size_t)
+{
+	depth++;
+	//cada objeto dentro de "entities" es una entidad nueva
+	if (depth == 3 && rootKey == ROOT_ENTITIES)
+		memset(&record, 0, sizeof(record));
+	else if (depth == 3 && rootKey == ROOT_ITEMS)
+		memset(&stack, 0, sizeof(stack));
+	axis = -1;
+	return true;
+}
+
+bool SaveJsonReader::end_object()
+{
+	if (depth == 3 && rootKey == ROOT_ENTITIES)
+		world.entities.push_back(record);
+	else if (depth == 3 && rootKey == ROOT_ITEMS)
+		world.items.push_back(stack);
+	depth--;
+	return true;
+}
+
+bool SaveJsonReader::start_array(std::size_t)
+{
+	depth++;
+	return true;
+}
+
+bool SaveJsonReader::end_array()
+{
+	if (depth == 2 && (rootKey == ROOT_TILEMAP || rootKey == ROOT_DECORMAP))
+		world.hasLevel = true;
+	depth--;
+	return true;
+}
+
+bool SaveJsonReader::key(string_t& val)
+{
+	const char* k = val.c_str();
+	if (depth == 1)
+	{
+		if (strcmp(k, "position") == 0) rootKey = ROOT_POSITION;
+		else if (strcmp(k, "health") == 0) rootKey = ROOT_HEALTH;
+		else if (strcmp(k, "level") == 0) rootKey = ROOT_LEVEL;
+		else if (strcmp(k, "energy") == 0) rootKey = ROOT_ENERGY;
+		else if (strcmp(k, "era") == 0) rootKey = ROOT_ERA;
+		else if (strcmp(k, "playTime") == 0) rootKey = ROOT_PLAYTIME;
+		else if (strcmp(k, "entities") == 0) rootKey = ROOT_ENTITIES;
+		else if (strcmp(k, "inventory") == 0) rootKey = ROOT_INVENTORY;
+		else if (strcmp(k, "items") == 0) rootKey = ROOT_ITEMS;
+		else if (strcmp(k, "currentWeapon") == 0) rootKey = ROOT_CURRENT_WEAPON;
+		else if (strcmp(k, "tileMap") == 0) rootKey = ROOT_TILEMAP;
+		else if (strcmp(k, "decorMap") == 0) rootKey = ROOT_DECORMAP;
+		else rootKey = ROOT_NONE;
+	}
+	else if (depth == 3 && rootKey == ROOT_ENTITIES)
+	{
+		if (strcmp(k, "id") == 0) entityKey = EK_ID;
+		else if (strcmp(k, "type") == 0) entityKey = EK_TYPE;
+		else if (strcmp(k, "flags") == 0) entityKey = EK_FLAGS;
+		else if (strcmp(k, "position") == 0) entityKey = EK_POSITION;
+		else if (strcmp(k, "vector") == 0) entityKey = EK_VECTOR;
+		else if (strcmp(k, "speed") == 0) entityKey = EK_SPEED;
+		else if (strcmp(k, "owner") == 0) entityKey = EK_OWNER;
+		else if (strcmp(k, "extra") == 0) entityKey = EK_EXTRA;
+		else if (strcmp(k, "name") == 0) entityKey = EK_NAME;
+		else if (strcmp(k, "texture") == 0) entityKey = EK_TEXTURE;
+		else entityKey = EK_NONE;
+	}
+	else if (depth == 3 && rootKey == ROOT_ITEMS)
+	{
+		if (strcmp(k, "name") == 0) itemKey = IK_NAME;
+		else if (strcmp(k, "count") == 0) itemKey = IK_COUNT;
+		else itemKey = IK_NONE;
+	}
+	else
+	{
+		//sub-objetos {x, y}
+		axis = (strcmp(k, "x") == 0) ? 0 : (strcmp(k, "y") == 0) ? 1 : -1;
+	}
+	return true;
+}
+
+bool SaveJsonReader::onNumber(double value)
+{
+	if (depth == 1)
+	{
+		switch (rootKey)
+		{
+		case ROOT_HEALTH: world.stats.health = (int)value; break;
+		case ROOT_LEVEL: world.stats.level = (int)value; break;
+		case ROOT_ENERGY: world.stats.energy = (int)value; break;
+		case ROOT_ERA: world.stats.era = (int)value; break;
+		case ROOT_PLAYTIME: world.stats.playTime = (float)value; break;
+		case ROOT_CURRENT_WEAPON: world.currentWeapon = (int)value; break;
+		default: break;
+		}
+	}
+	else if (depth == 2)
+	{
+		switch (rootKey)
+		{
+		case ROOT_POSITION:
+			hasLegacyPosition = true;
+			if (axis == 0) legacyPosition.x = (float)value;
+			else if (axis == 1) legacyPosition.y = (float)value;
+			break;
+		case ROOT_INVENTORY: world.inventory.push_back((uint32_t)value); break;
+		case ROOT_TILEMAP: world.tileMap.push_back((int32_t)value); break;
+		case ROOT_DECORMAP: world.decorMap.push_back((int32_t)value); break;
+		default: break;
+		}
+	}
+	else if (depth == 3 && rootKey == ROOT_ENTITIES)
+	{
+		switch (entityKey)
+		{
+		case EK_ID: record.id = (uint32_t)value; break;
+		case EK_TYPE: record.type = (EntityType)(int)value; break;
+		case EK_FLAGS: record.flags = (uint8_t)value; break;
+		case EK_SPEED: record.speed = (float)value; break;
+		case EK_OWNER: record.ownerId = (uint32_t)value; break;
+		case EK_EXTRA: record.extra = (int32_t)value; break;
+		default: break;
+		}
+	}
+	else if (depth == 3 && rootKey == ROOT_ITEMS && itemKey == IK_COUNT)
+	{
+		stack.count = (int32_t)value;
+	}
+	else if (depth == 4 && rootKey == ROOT_ENTITIES && axis >= 0)
+	{
+		Vector2* target = (entityKey == EK_POSITION) ? &record.position : (entityKey == EK_VECTOR) ? &record.vector : nullptr;
+		if (target)
+			(axis == 0 ? target->x : target->y) = (float)value;
+	}
+	return true;
+}
+
+bool SaveJsonReader::string(string_t& val)
+{
+	if (depth == 3 && rootKey == ROOT_ENTITIES)
+	{
+		char* target = (entityKey == EK_NAME) ? record.name : (entityKey == EK_TEXTURE) ? record.texture : nullptr;
+		size_t capacity = (entityKey == EK_NAME) ? sizeof(record.name) : sizeof(record.texture);
+		if (target)
+		{
+			strncpy(target, val.c_str(), capacity - 1);
+			target[capacity - 1] = '\0';
+		}
+	}
+	else if (depth == 3 && rootKey == ROOT_ITEMS && itemKey == IK_NAME)
+	{
+		strncpy(stack.name, val.c_str(), sizeof(stack.name) - 1);
+		stack.name[sizeof(stack.name) - 1] = '\0';
+	}
+	return true;
+}
+
+bool SaveJsonReader::parse_error(std::size_t position, const std::string&, const nlohmann::detail::exception& ex)
+{
+	std::cerr << "Partida JSON invalida en el byte " << position << ": " << ex.what() << std::endl;
+	return false;
+}
@@ -1,4 +1,22 @@
 #include "SaveManager.h"
+#include "Player.h"
+#include "Weapon.h"
+#include "sideKick.h"
+#include "TrailSystem.h"
+#include "Enemy.h"
+#include "ProjectileSystem.h"
+#include "Level.h"
+#include "SaveIndex.h"
+#include "ItemRegistry.h"
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <filesystem>
+#include <chrono>
+#include <iterator>
+#include "SaveJsonReader.h"
+
+using namespace Quetz_LabEDC;
 
 
 void SaveManager::SaveGame(int slot, Vector2 pos, int health, int level, int era) {
@@ -19,16 +37,697 @@ Vector2 SaveManager::LoadGame(int slot, int& health, int& level, int& era) {
     Vector2 pos = { 400, 300 }; // Posicin por defecto
     std::ifstream file("save_slot" + std::to_string(slot) + ".json");
     if (file.is_open()) {
-        json saveData;
-        file >> saveData;
-
-        pos.x = saveData["position"]["x"];
-        pos.y = saveData["position"]["y"];
-        health = saveData["health"];
-        level = saveData["level"];
-        era = saveData["era"];
+        // lectura SAX: los valores van directo a las variables, sin arbol JSON
+        WorldState world;
+        world.stats = { health, level, 0, era, 0.0f };
+        SaveJsonReader reader(world);
+        if (json::sax_parse(file, &reader)) {
+            if (reader.hasLegacyPosition)
+                pos = reader.legacyPosition;
+            health = world.stats.health;
+            level = world.stats.level;
+            era = world.stats.era;
+        }
 
         file.close();
     }
     return pos;
 }
+
+bool SaveManager::ImportJson(int slot, WorldState& world) {
+    std::ifstream file(SlotPath(slot, ".json"));
+    if (!file.is_open())
+        return false;
+    world = WorldState();
+    // se lee del stream por eventos: la memoria no crece con el tamano del archivo
+    SaveJsonReader reader(world);
+    return json::sax_parse(file, &reader);
+}
+
+// carga equivalente con el arbol completo, solo para comparar en el benchmark
+static bool ImportJsonDom(const std::string& text, WorldState& world) {
+    json saveData = json::parse(text, nullptr, false);
+    if (saveData.is_discarded())
+        return false;
+    world = WorldState();
+    world.stats.health = saveData.value("health", 0);
+    world.stats.level = saveData.value("level", 0);
+    world.stats.energy = saveData.value("energy", 0);
+    world.stats.era = saveData.value("era", 0);
+    world.stats.playTime = saveData.value("playTime", 0.0f);
+    for (const json& e : saveData["entities"]) {
+        EntityRecord record;
+        memset(&record, 0, sizeof(record));
+        record.id = e["id"];
+        record.type = (EntityType)e["type"].get<int>();
+        record.flags = e["flags"];
+        record.position = { e["position"]["x"], e["position"]["y"] };
+        record.vector = { e["vector"]["x"], e["vector"]["y"] };
+        record.speed = e["speed"];
+        record.ownerId = e["owner"];
+        record.extra = e["extra"];
+        strncpy(record.name, e["name"].get<std::string>().c_str(), sizeof(record.name) - 1);
+        strncpy(record.texture, e["texture"].get<std::string>().c_str(), sizeof(record.texture) - 1);
+        world.entities.push_back(record);
+    }
+    world.inventory = saveData["inventory"].get<std::vector<uint32_t>>();
+    if (saveData.contains("items")) {
+        for (const json& i : saveData["items"]) {
+            ItemStackRecord stack;
+            memset(&stack, 0, sizeof(stack));
+            strncpy(stack.name, i["name"].get<std::string>().c_str(), sizeof(stack.name) - 1);
+            stack.count = i["count"];
+            world.items.push_back(stack);
+        }
+    }
+    world.currentWeapon = saveData.value("currentWeapon", -1);
+    if (saveData.contains("tileMap")) {
+        world.tileMap = saveData["tileMap"].get<std::vector<int32_t>>();
+        world.decorMap = saveData["decorMap"].get<std::vector<int32_t>>();
+        world.hasLevel = true;
+    }
+    return true;
+}
+
+void SaveManager::BenchmarkJsonLoad(const std::string& path, int iterations) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "No se encontro " << path << std::endl;
+        return;
+    }
+    std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    // ambos caminos parten del mismo texto en memoria para medir solo el parseo
+    double domMs = 0.0, saxMs = 0.0;
+    size_t entities = 0;
+    for (int i = 0; i < iterations; i++) {
+        WorldState dom, sax;
+        auto start = std::chrono::steady_clock::now();
+        ImportJsonDom(text, dom);
+        auto middle = std::chrono::steady_clock::now();
+        SaveJsonReader reader(sax);
+        json::sax_parse(text, &reader);
+        auto end = std::chrono::steady_clock::now();
+
+        domMs += std::chrono::duration<double, std::milli>(middle - start).count();
+        saxMs += std::chrono::duration<double, std::milli>(end - middle).count();
+        entities = sax.entities.size();
+    }
+    std::cout << path << " (" << text.size() << " bytes, " << entities << " entidades)" << std::endl;
+    std::cout << "  DOM: " << domMs / iterations << " ms  SAX: " << saxMs / iterations << " ms" << std::endl;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Formato binario
+//////////////////////////////////////////////////////////////////////////
+
+static constexpr uint32_t FourCC(char a, char b, char c, char d)
+{
+    return (uint32_t)(uint8_t)a | ((uint32_t)(uint8_t)b << 8) | ((uint32_t)(uint8_t)c << 16) | ((uint32_t)(uint8_t)d << 24);
+}
+
+static constexpr uint32_t SAVE_MAGIC = FourCC('E', 'D', 'C', 'S');
+static constexpr uint32_t SECTION_STATS = FourCC('S', 'T', 'A', 'T');
+static constexpr uint32_t SECTION_ENTITIES = FourCC('E', 'N', 'T', 'S');
+static constexpr uint32_t SECTION_INVENTORY = FourCC('I', 'N', 'V', 'T');
+static constexpr uint32_t SECTION_LEVEL = FourCC('L', 'E', 'V', 'L');
+
+// ids de campos (no reutilizar numeros, van en el archivo)
+enum EStatsField : uint8_t { STAT_HEALTH = 1, STAT_LEVEL, STAT_ENERGY, STAT_ERA, STAT_PLAYTIME };
+enum EEntityField : uint8_t { ENT_ID = 1, ENT_TYPE, ENT_FLAGS, ENT_POSITION, ENT_VECTOR, ENT_SPEED, ENT_OWNER, ENT_EXTRA, ENT_NAME, ENT_TEXTURE };
+enum EInventoryField : uint8_t { INV_CURRENT = 1, INV_WEAPONS, INV_ITEMS };
+enum ELevelField : uint8_t { LVL_WIDTH = 1, LVL_HEIGHT, LVL_TILES, LVL_DECOR };
+
+struct SectionEntry
+{
+    uint32_t id;
+    uint32_t offset;
+    uint32_t size;
+};
+
+std::string SaveManager::SlotPath(int slot, const char* extension)
+{
+    return "save_slot" + std::to_string(slot) + extension;
+}
+
+WorldState SaveManager::CaptureWorld(const PlayerStats& stats)
+{
+    WorldState world;
+    world.stats = stats;
+    world.entities.reserve(GameObject::gameObjects.size() + 8);
+
+    Player* player = nullptr;
+    for (GameObject* obj : GameObject::gameObjects)
+    {
+        EntityRecord record;
+        obj->Capture(record);
+        record.flags |= ENTITY_IN_WORLD;
+        world.entities.push_back(record);
+        if (!player)
+            player = dynamic_cast<Player*>(obj);
+    }
+
+    //las armas del inventario no siempre estan en gameObjects
+    if (player && player->GetInventory())
+    {
+        Inventory* inventory = player->GetInventory();
+        for (const InventorySlot& slot : *inventory)
+        {
+            Weapon* weapon = slot.weapon;
+            if (!weapon)
+            {
+                const Item* item = ItemRegistry::getInstance().Find(slot.itemId);
+                if (!item)
+                    continue;
+                ItemStackRecord stack;
+                memset(&stack, 0, sizeof(stack));
+                strncpy(stack.name, item->name.c_str(), sizeof(stack.name) - 1);
+                stack.count = slot.count;
+                world.items.push_back(stack);
+                continue;
+            }
+            world.inventory.push_back(weapon->id);
+            if (std::find(GameObject::gameObjects.begin(), GameObject::gameObjects.end(), weapon) == GameObject::gameObjects.end())
+            {
+                EntityRecord record;
+                weapon->Capture(record);
+                world.entities.push_back(record);
+            }
+        }
+        world.currentWeapon = inventory->GetCurrentIndex();
+    }
+
+    //los proyectiles no son GameObjects: vienen del sistema de proyectiles
+    ProjectileSystem& projectiles = ProjectileSystem::getInstance();
+    for (size_t i = 0; i < projectiles.GetCount(); i++)
+    {
+        EntityRecord record;
+        projectiles.Capture(i, record);
+        world.entities.push_back(record);
+    }
+
+    Level& level = Level::getInstance();
+    world.hasLevel = true;
+    world.tileMap.assign(&level.tileMap[0][0], &level.tileMap[0][0] + Level::MAP_WIDTH * Level::MAP_HEIGHT);
+    world.decorMap.assign(&level.decorMap[0][0], &level.decorMap[0][0] + Level::MAP_WIDTH * Level::MAP_HEIGHT);
+    return world;
+}
+
+GameObject* SaveManager::CreateFromRecord(const EntityRecord& record)
+{
+    switch (record.type)
+    {
+    case EntityType::Player:
+    {
+        Player* player = new Player(record.position, record.name);
+        player->start();
+        return player;
+    }
+    case EntityType::Weapon:
+        return new Weapon(record.position, record.name, Texture{ 0 });
+    case EntityType::SideKick:
+        return new sideKick(record.position, record.name, Texture{ 0 });
+    case EntityType::Enemy:
+        return new Enemy(record.position, record.name, nullptr);
+    default:
+        return new GameObject(record.position, record.name, Texture{ 0 });
+    }
+}
+
+Player* SaveManager::ApplyWorld(const WorldState& world)
+{
+    //objetos actuales por id, para reutilizarlos en lugar de recrearlos
+    std::unordered_map<uint32_t, GameObject*> existing;
+    Player* currentPlayer = nullptr;
+    for (GameObject* obj : GameObject::gameObjects)
+    {
+        existing[obj->id] = obj;
+        if (!currentPlayer)
+            currentPlayer = dynamic_cast<Player*>(obj);
+    }
+    if (currentPlayer && currentPlayer->GetInventory())
+    {
+        for (const InventorySlot& slot : *currentPlayer->GetInventory())
+            if (slot.weapon)
+                existing[slot.weapon->id] = slot.weapon;
+        currentPlayer->GetInventory()->Clear();
+    }
+
+    std::unordered_map<uint32_t, GameObject*> byId;
+    std::vector<GameObject*> world_objects;
+    world_objects.reserve(world.entities.size());
+    Player* player = nullptr;
+    uint32_t maxId = 0;
+    ProjectileSystem& projectiles = ProjectileSystem::getInstance();
+    projectiles.Clear();
+    //los rastros de los lideres no se guardan: se vuelven a tomar desde aqui
+    TrailSystem::getInstance().Clear();
+
+    for (const EntityRecord& record : world.entities)
+    {
+        if (record.type == EntityType::Projectile)
+        {
+            projectiles.Restore(record);
+            continue;
+        }
+        GameObject* obj = nullptr;
+        //el jugador siempre se reutiliza: el resto del juego guarda su puntero
+        if (record.type == EntityType::Player && currentPlayer && existing.count(currentPlayer->id))
+        {
+            obj = currentPlayer;
+            existing.erase(currentPlayer->id);
+        }
+        else
+        {
+            auto it = existing.find(record.id);
+            if (it != existing.end() && it->second->GetType() == record.type)
+            {
+                obj = it->second;
+                existing.erase(it);
+            }
+            else
+            {
+                obj = CreateFromRecord(record);
+            }
+        }
+
+        obj->Restore(record);
+        byId[record.id] = obj;
+        if (record.id > maxId)
+            maxId = record.id;
+        if (record.flags & ENTITY_IN_WORLD)
+            world_objects.push_back(obj);
+        if (!player)
+            player = dynamic_cast<Player*>(obj);
+    }
+
+    //lo que no esta en la partida guardada se destruye
+    for (auto& entry : existing)
+    {
+        if (entry.second != currentPlayer)
+            delete entry.second;
+    }
+    GameObject::gameObjects = world_objects;
+    if (maxId >= GameObject::nextId)
+        GameObject::nextId = maxId + 1;
+
+    //segunda pasada: referencias entre objetos
+    for (const EntityRecord& record : world.entities)
+    {
+        GameObject* obj = byId[record.id];
+        GameObject* owner = record.ownerId ? byId[record.ownerId] : nullptr;
+        if (Weapon* weapon = dynamic_cast<Weapon*>(obj))
+            weapon->owner = dynamic_cast<Player*>(owner);
+        else if (sideKick* sk = dynamic_cast<sideKick*>(obj))
+            sk->owner = owner;
+        else if (Enemy* enemy = dynamic_cast<Enemy*>(obj))
+            enemy->target = player;
+    }
+
+    if (player && player->GetInventory())
+    {
+        for (uint32_t weaponId : world.inventory)
+        {
+            Weapon* weapon = dynamic_cast<Weapon*>(byId[weaponId]);
+            if (weapon)
+                player->GetInventory()->PickupWeapon(weapon, player);
+        }
+        //los items se registran por nombre: su id puede ser otro en esta sesion
+        for (const ItemStackRecord& stack : world.items)
+            player->GetInventory()->AddItem(ItemRegistry::getInstance().Register(stack.name), stack.count);
+        player->GetInventory()->SetCurrentIndex(world.currentWeapon, player);
+    }
+
+    if (world.hasLevel && world.tileMap.size() == Level::MAP_WIDTH * Level::MAP_HEIGHT && world.decorMap.size() == world.tileMap.size())
+    {
+        Level& level = Level::getInstance();
+        memcpy(level.tileMap, world.tileMap.data(), world.tileMap.size() * sizeof(int32_t));
+        memcpy(level.decorMap, world.decorMap.data(), world.decorMap.size() * sizeof(int32_t));
+    }
+    return player;
+}
+
+void SaveManager::EncodeWorld(const WorldState& world, SaveWriter& out)
+{
+    const uint32_t sectionIds[] = { SECTION_STATS, SECTION_ENTITIES, SECTION_INVENTORY, SECTION_LEVEL };
+    const uint16_t sectionCount = world.hasLevel ? 4 : 3;
+
+    out.Write(SAVE_MAGIC);
+    out.Write(SAVE_VERSION);
+    out.Write(sectionCount);
+    size_t tableOffset = out.Size();
+    for (int i = 0; i < sectionCount; i++)
+        out.Write(SectionEntry{ sectionIds[i], 0, 0 });
+
+    for (int i = 0; i < sectionCount; i++)
+    {
+        size_t start = out.Size();
+        switch (sectionIds[i])
+        {
+        case SECTION_STATS:
+            out.FieldI32(STAT_HEALTH, world.stats.health);
+            out.FieldI32(STAT_LEVEL, world.stats.level);
+            out.FieldI32(STAT_ENERGY, world.stats.energy);
+            out.FieldI32(STAT_ERA, world.stats.era);
+            out.FieldF32(STAT_PLAYTIME, world.stats.playTime);
+            break;
+
+        case SECTION_ENTITIES:
+            out.Write((uint32_t)world.entities.size());
+            for (const EntityRecord& record : world.entities)
+            {
+                //los campos en cero no se escriben
+                size_t countOffset = out.Size();
+                uint8_t fieldCount = 5;
+                out.Write(fieldCount);
+                out.FieldU32(ENT_ID, record.id);
+                out.FieldU32(ENT_TYPE, (uint32_t)record.type);
+                out.FieldU32(ENT_FLAGS, record.flags);
+                out.FieldVec2(ENT_POSITION, record.position);
+                out.FieldStr(ENT_NAME, record.name);
+                if (record.vector.x != 0 || record.vector.y != 0) { out.FieldVec2(ENT_VECTOR, record.vector); fieldCount++; }
+                if (record.speed != 0) { out.FieldF32(ENT_SPEED, record.speed); fieldCount++; }
+                if (record.ownerId != 0) { out.FieldU32(ENT_OWNER, record.ownerId); fieldCount++; }
+                if (record.extra != 0) { out.FieldI32(ENT_EXTRA, record.extra); fieldCount++; }
+                if (record.texture[0] != '\0') { out.FieldStr(ENT_TEXTURE, record.texture); fieldCount++; }
+                out.Patch(countOffset, fieldCount);
+            }
+            break;
+
+        case SECTION_INVENTORY:
+            out.FieldI32(INV_CURRENT, world.currentWeapon);
+            out.FieldBlob(INV_WEAPONS, world.inventory.data(), (uint32_t)(world.inventory.size() * sizeof(uint32_t)));
+            if (!world.items.empty())
+                out.FieldBlob(INV_ITEMS, world.items.data(), (uint32_t)(world.items.size() * sizeof(ItemStackRecord)));
+            break;
+
+        case SECTION_LEVEL:
+            out.FieldI32(LVL_WIDTH, Level::MAP_WIDTH);
+            out.FieldI32(LVL_HEIGHT, Level::MAP_HEIGHT);
+            out.FieldBlob(LVL_TILES, world.tileMap.data(), (uint32_t)(world.tileMap.size() * sizeof(int32_t)));
+            out.FieldBlob(LVL_DECOR, world.decorMap.data(), (uint32_t)(world.decorMap.size() * sizeof(int32_t)));
+            break;
+        }
+        out.Patch(tableOffset + i * sizeof(SectionEntry), SectionEntry{ sectionIds[i], (uint32_t)start, (uint32_t)(out.Size() - start) });
+    }
+}
+
+static bool DecodeEntities(SaveReader& in, size_t end, WorldState& world)
+{
+    uint32_t count;
+    if (!in.Read(count))
+        return false;
+    //cada entidad ocupa por lo menos unos bytes, evita reservar basura
+    if (count > (end - in.Position()) / 4)
+        return false;
+    world.entities.reserve(count);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        EntityRecord record;
+        memset(&record, 0, sizeof(record));
+        uint8_t fieldCount;
+        if (!in.Read(fieldCount))
+            return false;
+        for (uint8_t f = 0; f < fieldCount; f++)
+        {
+            uint8_t id, type;
+            uint32_t value = 0;
+            if (!in.FieldHeader(id, type))
+                return false;
+            switch (id)
+            {
+            case ENT_ID: in.ReadU32(type, record.id); break;
+            case ENT_TYPE: in.ReadU32(type, value); record.type = (EntityType)value; break;
+            case ENT_FLAGS: in.ReadU32(type, value); record.flags = (uint8_t)value; break;
+            case ENT_POSITION: in.ReadVec2(type, record.position); break;
+            case ENT_VECTOR: in.ReadVec2(type, record.vector); break;
+            case ENT_SPEED: in.ReadF32(type, record.speed); break;
+            case ENT_OWNER: in.ReadU32(type, record.ownerId); break;
+            case ENT_EXTRA: in.ReadI32(type, record.extra); break;
+            case ENT_NAME: in.ReadStr(type, record.name, sizeof(record.name)); break;
+            case ENT_TEXTURE: in.ReadStr(type, record.texture, sizeof(record.texture)); break;
+            default: in.Skip(type); break; //campo de una version mas nueva
+            }
+        }
+        if (!in.Ok() || in.Position() > end)
+            return false;
+        world.entities.push_back(record);
+    }
+    return true;
+}
+
+bool SaveManager::DecodeWorld(const uint8_t* data, size_t size, WorldState& world)
+{
+    SaveReader in(data, size);
+    uint32_t magic;
+    uint16_t version, sectionCount;
+    if (!in.Read(magic) || magic != SAVE_MAGIC || !in.Read(version) || !in.Read(sectionCount))
+        return false;
+    if (version > SAVE_VERSION)
+    {
+        std::cerr << "Partida guardada con una version mas nueva (" << version << ")" << std::endl;
+        return false;
+    }
+
+    std::vector<SectionEntry> sections(sectionCount);
+    for (SectionEntry& section : sections)
+    {
+        if (!in.Read(section))
+            return false;
+    }
+
+    world = WorldState();
+    for (const SectionEntry& section : sections)
+    {
+        size_t end = (size_t)section.offset + section.size;
+        if (end > size)
+            return false;
+        in.Seek(section.offset);
+
+        if (section.id == SECTION_ENTITIES)
+        {
+            if (!DecodeEntities(in, end, world))
+                return false;
+            continue;
+        }
+
+        //secciones de campos sueltos: se leen hasta el final de la seccion
+        while (in.Ok() && in.Position() < end)
+        {
+            uint8_t id, type;
+            uint32_t blobSize;
+            const uint8_t* blob;
+            if (!in.FieldHeader(id, type))
+                return false;
+
+            if (section.id == SECTION_STATS)
+            {
+                switch (id)
+                {
+                case STAT_HEALTH: in.ReadI32(type, world.stats.health); break;
+                case STAT_LEVEL: in.ReadI32(type, world.stats.level); break;
+                case STAT_ENERGY: in.ReadI32(type, world.stats.energy); break;
+                case STAT_ERA: in.ReadI32(type, world.stats.era); break;
+                case STAT_PLAYTIME: in.ReadF32(type, world.stats.playTime); break;
+                default: in.Skip(type); break;
+                }
+            }
+            else if (section.id == SECTION_INVENTORY)
+            {
+                switch (id)
+                {
+                case INV_CURRENT: in.ReadI32(type, world.currentWeapon); break;
+                case INV_WEAPONS:
+                    blob = in.ReadBlob(type, blobSize);
+                    if (blob && blobSize > 0)
+                    {
+                        world.inventory.resize(blobSize / sizeof(uint32_t));
+                        memcpy(world.inventory.data(), blob, world.inventory.size() * sizeof(uint32_t));
+                    }
+                    break;
+                case INV_ITEMS:
+                    blob = in.ReadBlob(type, blobSize);
+                    if (blob && blobSize > 0)
+                    {
+                        world.items.resize(blobSize / sizeof(ItemStackRecord));
+                        memcpy(world.items.data(), blob, world.items.size() * sizeof(ItemStackRecord));
+                        for (ItemStackRecord& stack : world.items)
+                            stack.name[sizeof(stack.name) - 1] = '\0';
+                    }
+                    break;
+                default: in.Skip(type); break;
+                }
+            }
+            else if (section.id == SECTION_LEVEL)
+            {
+                switch (id)
+                {
+                case LVL_TILES:
+                case LVL_DECOR:
+                {
+                    blob = in.ReadBlob(type, blobSize);
+                    std::vector<int32_t>& target = (id == LVL_TILES) ? world.tileMap : world.decorMap;
+                    if (blob && blobSize > 0)
+                    {
+                        target.resize(blobSize / sizeof(int32_t));
+                        memcpy(target.data(), blob, target.size() * sizeof(int32_t));
+                    }
+                    break;
+                }
+                default: in.Skip(type); break; //el tamano se valida al aplicar
+                }
+                world.hasLevel = true;
+            }
+            else
+            {
+                break; //seccion desconocida: se ignora completa
+            }
+        }
+        if (!in.Ok())
+            return false;
+    }
+    return true;
+}
+
+// archivo comprimido: magic + tamano original + datos DEFLATE
+static constexpr uint32_t SAVE_MAGIC_COMPRESSED = FourCC('E', 'D', 'C', 'Z');
+
+bool SaveManager::SaveWorld(int slot, const WorldState& world)
+{
+    return WriteWorldFile(slot, world);
+}
+
+bool SaveManager::WriteWorldFile(int slot, const WorldState& world, bool compress)
+{
+    SaveWriter out;
+    EncodeWorld(world, out);
+
+    const uint8_t* bytes = out.data.data();
+    size_t size = out.data.size();
+    unsigned char* compressed = nullptr;
+    int compressedSize = 0;
+    if (compress)
+        compressed = CompressData(bytes, (int)size, &compressedSize);
+
+    bool ok;
+    if (compressed)
+    {
+        uint32_t header[2] = { SAVE_MAGIC_COMPRESSED, (uint32_t)size };
+        ok = WriteFileAtomic(SlotPath(slot, ".sav"), header, sizeof(header), compressed, (size_t)compressedSize);
+        MemFree(compressed);
+    }
+    else
+    {
+        ok = WriteFileAtomic(SlotPath(slot, ".sav"), nullptr, 0, bytes, size);
+    }
+
+    //el indice de slots se actualiza en cada guardado
+    if (ok)
+        SaveIndex::Update(slot, world);
+    return ok;
+}
+
+bool SaveManager::WriteFileAtomic(const std::string& path, const void* header, size_t headerSize, const void* body, size_t bodySize)
+{
+    std::string tempPath = path + ".tmp";
+    bool ok;
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (headerSize > 0)
+            file.write((const char*)header, headerSize);
+        file.write((const char*)body, bodySize);
+        file.flush();
+        ok = file.good();
+    }
+
+    if (!ok)
+    {
+        std::error_code ignored;
+        std::filesystem::remove(tempPath, ignored);
+        return false;
+    }
+
+    //el rename reemplaza el archivo anterior de una sola vez
+    std::error_code error;
+    std::filesystem::rename(tempPath, path, error);
+    if (error)
+    {
+        std::cerr << "No se pudo reemplazar " << path << ": " << error.message() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool SaveManager::LoadWorld(int slot, WorldState& world)
+{
+    std::ifstream file(SlotPath(slot, ".sav"), std::ios::binary | std::ios::ate);
+    //sin .sav se acepta una partida JSON (exportada o escrita a mano) por el lector SAX
+    if (!file.is_open())
+        return ImportJson(slot, world);
+    std::vector<uint8_t> data((size_t)file.tellg());
+    file.seekg(0);
+    file.read((char*)data.data(), data.size());
+    if (!file)
+        return false;
+
+    uint32_t magic = 0;
+    if (data.size() >= 8)
+        memcpy(&magic, data.data(), sizeof(magic));
+    if (magic == SAVE_MAGIC_COMPRESSED)
+    {
+        int rawSize = 0;
+        unsigned char* raw = DecompressData(data.data() + 8, (int)data.size() - 8, &rawSize);
+        if (!raw)
+            return false;
+        bool ok = DecodeWorld(raw, (size_t)rawSize, world);
+        MemFree(raw);
+        return ok;
+    }
+    return DecodeWorld(data.data(), data.size(), world);
+}
+
+void SaveManager::ExportJson(int slot, const WorldState& world)
+{
+    json saveData;
+    saveData["version"] = SAVE_VERSION;
+    saveData["health"] = world.stats.health;
+    saveData["level"] = world.stats.level;
+    saveData["energy"] = world.stats.energy;
+    saveData["era"] = world.stats.era;
+    saveData["playTime"] = world.stats.playTime;
+
+    json entities = json::array();
+    for (const EntityRecord& record : world.entities)
+    {
+        entities.push_back({
+            {"id", record.id},
+            {"type", (int)record.type},
+            {"flags", record.flags},
+            {"position", { {"x", record.position.x}, {"y", record.position.y} }},
+            {"vector", { {"x", record.vector.x}, {"y", record.vector.y} }},
+            {"speed", record.speed},
+            {"owner", record.ownerId},
+            {"extra", record.extra},
+            {"name", record.name},
+            {"texture", record.texture}
+        });
+    }
+    saveData["entities"] = entities;
+    saveData["inventory"] = world.inventory;
+    json items = json::array();
+    for (const ItemStackRecord& stack : world.items)
+        items.push_back({ {"name", stack.name}, {"count", stack.count} });
+    saveData["items"] = items;
+    saveData["currentWeapon"] = world.currentWeapon;
+    if (world.hasLevel)
+    {
+        saveData["tileMap"] = world.tileMap;
+        saveData["decorMap"] = world.decorMap;
+    }
+
+    std::ofstream file(SlotPath(slot, ".json"));
+    if (file.is_open()) {
+        file << saveData.dump(4);
+    }
+}
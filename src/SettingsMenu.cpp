@@ -0,0 +1,74 @@
+#include "SettingsMenu.h"
+#include "QualityGovernor.h"
+#include <iterator>
+
+void SettingsMenu::update()
+{
+	if (!open)
+		return;
+	if (IsKeyPressed(KEY_S)) selected = (selected + 1) % ROW_COUNT;
+	if (IsKeyPressed(KEY_W)) selected = (selected - 1 + ROW_COUNT) % ROW_COUNT;
+	if (IsKeyPressed(KEY_D)) Change(1);
+	if (IsKeyPressed(KEY_A)) Change(-1);
+	if (IsKeyPressed(KEY_BACKSPACE) || (IsKeyPressed(KEY_ENTER) && selected == ROW_BACK))
+		Close();
+}
+
+void SettingsMenu::Change(int direction)
+{
+	QualityGovernor& governor = QualityGovernor::getInstance();
+	//grabando o repitiendo el nivel no se toca (la simulacion depende de el)
+	if (governor.IsLocked() && selected != ROW_FPS)
+		return;
+	switch (selected)
+	{
+	case ROW_AUTO:
+		governor.SetAuto(!governor.IsAuto());
+		break;
+	case ROW_LEVEL:
+		//elegir un nivel a mano apaga el ajuste automatico
+		governor.SetAuto(false);
+		governor.SetLevel(governor.GetLevel() + direction);
+		break;
+	case ROW_FPS:
+	{
+		int count = (int)std::size(FPS_OPTIONS);
+		int current = 0;
+		for (int i = 0; i < count; i++)
+			if (FPS_OPTIONS[i] == governor.GetTargetFps()) current = i;
+		int fps = FPS_OPTIONS[(current + direction + count) % count];
+		governor.SetTargetFps(fps);
+		SetTargetFPS(fps);
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+void SettingsMenu::draw() const
+{
+	if (!open)
+		return;
+	const QualityGovernor& governor = QualityGovernor::getInstance();
+	const QualitySettings& settings = governor.GetSettings();
+
+	DrawText("CONFIGURACION", ROW_X, ROW_Y - 80, 40, WHITE);
+	//TextFormat reutiliza pocos buffers: cada texto se dibuja en cuanto se arma
+	DrawText(TextFormat("Calidad automatica: %s", governor.IsAuto() ? "Si" : "No"), ROW_X, ROW_Y + ROW_AUTO * ROW_HEIGHT, 30, WHITE);
+	DrawText(TextFormat("Nivel de calidad: %s", settings.name), ROW_X, ROW_Y + ROW_LEVEL * ROW_HEIGHT, 30, WHITE);
+	DrawText(TextFormat("FPS objetivo: %i", governor.GetTargetFps()), ROW_X, ROW_Y + ROW_FPS * ROW_HEIGHT, 30, WHITE);
+	DrawText("Volver", ROW_X, ROW_Y + ROW_BACK * ROW_HEIGHT, 30, WHITE);
+	DrawText(">", ROW_X - 30, ROW_Y + selected * ROW_HEIGHT, 30, WHITE);
+
+	//lo que controla el nivel actual
+	int y = ROW_Y + ROW_COUNT * ROW_HEIGHT + 20;
+	DrawText(TextFormat("IA media/lejana cada %i/%i ticks, tope %i", settings.aiMidInterval, settings.aiFarInterval,
+		settings.aiMaxTicksPerFrame), ROW_X, y, 20, LIGHTGRAY);
+	DrawText(TextFormat("Proyectiles %i, particulas %i", settings.maxProjectiles, settings.maxParticles), ROW_X, y + 24, 20, LIGHTGRAY);
+	DrawText(TextFormat("Animacion cada %i ticks, nombres %s", settings.animationInterval, settings.drawNames ? "si" : "no"),
+		ROW_X, y + 48, 20, LIGHTGRAY);
+	if (governor.IsLocked())
+		DrawText("Grabando o repitiendo: nivel fijo", ROW_X, y + 80, 20, ORANGE);
+	DrawText("W/S elegir  A/D cambiar  Retroceso volver", ROW_X, y + 120, 20, GRAY);
+}
@@ -0,0 +1,69 @@
+#include "SimulationThread.h"
+#include "FrameArena.h"
+#include <chrono>
+
+SimulationThread* SimulationThread::instance = nullptr;
+
+void SimulationThread::Kick()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!running)
+		{
+			running = true;
+			worker = std::thread(&SimulationThread::Run, this);
+		}
+		kicked = true;
+	}
+	wakeUp.notify_one();
+}
+
+const RenderSnapshot& SimulationThread::Wait()
+{
+	auto start = std::chrono::steady_clock::now();
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		finished.wait(lock, [this] { return !kicked; });
+	}
+	lastWaitMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+	front = 1 - front;
+	return buffers[front];
+}
+
+void SimulationThread::Run()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	while (true)
+	{
+		wakeUp.wait(lock, [this] { return kicked || !running; });
+		if (!kicked)
+			break;
+		//el buffer de atras no lo toca el hilo principal hasta el Wait
+		RenderSnapshot& back = buffers[1 - front];
+		lock.unlock();
+
+		auto start = std::chrono::steady_clock::now();
+		FrameArena::NewFrame(); //la arena de este hilo
+		back.Clear();
+		if (tick)
+			tick(back);
+		lastTickMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		lock.lock();
+		kicked = false;
+		finished.notify_one();
+	}
+}
+
+void SimulationThread::Stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!running)
+			return;
+		running = false;
+	}
+	wakeUp.notify_one();
+	//si habia un tick en curso se termina antes de salir
+	worker.join();
+}
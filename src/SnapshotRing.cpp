@@ -0,0 +1,422 @@
+#include "SnapshotRing.h"
+#include "SaveManager.h"
+#include "GameObject.h"
+#include "GameRandom.h"
+#include "Player.h"
+#include "Weapon.h"
+#include "ProjectileSystem.h"
+#include "TrailSystem.h"
+#include "ItemRegistry.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+using namespace Quetz_LabEDC;
+
+SnapshotRing::SnapshotRing(int slotCount)
+	: capacity(slotCount < 1 ? 1 : slotCount), slots(capacity)
+{
+	Layout(INITIAL_ENTITIES, INITIAL_INVENTORY);
+	restoreScratch.tileMap.reserve(MAP_CELLS);
+	restoreScratch.decorMap.reserve(MAP_CELLS);
+}
+
+SnapshotRing::~SnapshotRing()
+{
+	::operator delete(pool);
+	::operator delete(staging);
+}
+
+bool SnapshotRing::Layout(uint32_t entities, uint32_t inventorySize)
+{
+	size_t inventoryAt = ENTITIES_OFFSET + (size_t)entities * sizeof(EntityRecord);
+	size_t tileMapAt = inventoryAt + (size_t)inventorySize * sizeof(uint32_t);
+	size_t decorMapAt = tileMapAt + MAP_CELLS * sizeof(int32_t);
+	size_t pages = (decorMapAt + MAP_CELLS * sizeof(int32_t) + PAGE_SIZE - 1) / PAGE_SIZE;
+	//siempre deben caber la copia base y una nueva completa
+	if (pages * 2 > MAX_POOL_PAGES)
+		return false;
+
+	maxEntities = entities;
+	maxInventory = inventorySize;
+	inventoryOffset = inventoryAt;
+	tileMapOffset = tileMapAt;
+	decorMapOffset = decorMapAt;
+	pageCount = pages;
+	poolPages = (int)std::min(pages * (size_t)(capacity / 4 + 2), MAX_POOL_PAGES);
+
+	::operator delete(pool);
+	::operator delete(staging);
+	pool = static_cast<unsigned char*>(::operator new((size_t)poolPages * PAGE_SIZE));
+	staging = static_cast<unsigned char*>(::operator new(pageCount * PAGE_SIZE));
+	memset(staging, 0, pageCount * PAGE_SIZE);
+	refCount.assign(poolPages, 0);
+	freePages.clear();
+	freePages.reserve(poolPages);
+	for (int i = poolPages - 1; i >= 0; i--)
+		freePages.push_back((uint16_t)i);
+	for (Slot& slot : slots)
+	{
+		slot.pages.assign(pageCount, 0);
+		slot.dirty.assign((pageCount + 63) / 64, 0);
+		slot.dirtyCount = 0;
+	}
+	head = 0;
+	count = 0;
+	stagedEntities = 0;
+	stagedInventory = 0;
+
+	restoreScratch.entities.reserve(maxEntities);
+	restoreScratch.inventory.reserve(maxInventory);
+	restoreObjects.reserve(maxEntities);
+	return true;
+}
+
+bool SnapshotRing::WriteImage(const PlayerStats& stats, uint32_t tick)
+{
+	EntityRecord* records = reinterpret_cast<EntityRecord*>(staging + ENTITIES_OFFSET);
+	uint32_t* inventory = reinterpret_cast<uint32_t*>(staging + inventoryOffset);
+	uint32_t entityCount = 0;
+	uint32_t inventoryCount = 0;
+	uint32_t itemCount = 0;
+	uint32_t inventoryWords = 0;
+	int32_t currentWeapon = -1;
+
+	//lo que no cabe se sigue contando sin escribirlo, para saber cuanto crecer
+	auto nextRecord = [&]() -> EntityRecord* {
+		uint32_t index = entityCount++;
+		return index < maxEntities ? &records[index] : nullptr;
+	};
+
+	Player* player = nullptr;
+	for (GameObject* obj : GameObject::gameObjects)
+	{
+		if (EntityRecord* record = nextRecord())
+		{
+			obj->Capture(*record);
+			record->flags |= ENTITY_IN_WORLD;
+		}
+		if (!player)
+			player = dynamic_cast<Player*>(obj);
+	}
+
+	//mismas reglas que SaveManager::CaptureWorld para las armas fuera del mundo
+	if (player && player->GetInventory())
+	{
+		Inventory* playerInventory = player->GetInventory();
+		for (const InventorySlot& slot : *playerInventory)
+		{
+			Weapon* weapon = slot.weapon;
+			if (!weapon)
+				continue;
+			if (inventoryWords < maxInventory)
+				inventory[inventoryWords] = weapon->id;
+			inventoryWords++;
+			inventoryCount++;
+			if (std::find(GameObject::gameObjects.begin(), GameObject::gameObjects.end(), weapon) == GameObject::gameObjects.end())
+			{
+				if (EntityRecord* record = nextRecord())
+					weapon->Capture(*record);
+			}
+		}
+		currentWeapon = playerInventory->GetCurrentIndex();
+
+		//despues de las armas, los items apilables como pares (id, cantidad)
+		for (const InventorySlot& slot : *playerInventory)
+		{
+			if (slot.weapon)
+				continue;
+			if (inventoryWords + 2 <= maxInventory)
+			{
+				inventory[inventoryWords] = (uint32_t)slot.itemId;
+				inventory[inventoryWords + 1] = (uint32_t)slot.count;
+			}
+			inventoryWords += 2;
+			itemCount++;
+		}
+	}
+
+	ProjectileSystem& projectiles = ProjectileSystem::getInstance();
+	for (size_t i = 0; i < projectiles.GetCount(); i++)
+	{
+		if (EntityRecord* record = nextRecord())
+			projectiles.Capture(i, *record);
+	}
+	if (entityCount > maxEntities || inventoryWords > maxInventory)
+	{
+		requiredEntities = entityCount;
+		requiredInventory = inventoryWords;
+		return false;
+	}
+
+	//lo que quedo de la copia anterior se limpia para que las paginas comparen igual
+	if (entityCount < stagedEntities)
+		memset(records + entityCount, 0, (stagedEntities - entityCount) * sizeof(EntityRecord));
+	if (inventoryWords < stagedInventory)
+		memset(inventory + inventoryWords, 0, (stagedInventory - inventoryWords) * sizeof(uint32_t));
+	stagedEntities = entityCount;
+	stagedInventory = inventoryWords;
+
+	Header header = {};
+	header.tick = tick;
+	header.nextId = GameObject::nextId;
+	header.rngState = GameRandom::getInstance().GetState();
+	header.stats = stats;
+	header.entityCount = entityCount;
+	header.inventoryCount = inventoryCount;
+	header.itemCount = itemCount;
+	header.currentWeapon = currentWeapon;
+	memcpy(staging, &header, sizeof(header));
+
+	Level& level = Level::getInstance();
+	memcpy(staging + tileMapOffset, level.tileMap, MAP_CELLS * sizeof(int32_t));
+	memcpy(staging + decorMapOffset, level.decorMap, MAP_CELLS * sizeof(int32_t));
+	return true;
+}
+
+void SnapshotRing::ReleaseSlot(Slot& slot)
+{
+	for (size_t p = 0; p < pageCount; p++)
+	{
+		if (--refCount[slot.pages[p]] == 0)
+			freePages.push_back(slot.pages[p]);
+	}
+}
+
+void SnapshotRing::DropOldest()
+{
+	ReleaseSlot(slots[SlotIndex(count - 1)]);
+	count--;
+}
+
+bool SnapshotRing::Capture(const PlayerStats& stats, uint32_t tick)
+{
+	auto start = std::chrono::steady_clock::now();
+
+	if (!WriteImage(stats, tick))
+	{
+		//el mundo ya no cabe: la imagen crece al doble (o a lo pedido) y se vuelve a escribir
+		uint32_t entities = requiredEntities > maxEntities ? std::max(requiredEntities, maxEntities * 2) : maxEntities;
+		uint32_t inventorySize = requiredInventory > maxInventory ? std::max(requiredInventory, maxInventory * 2) : maxInventory;
+		if (!Layout(entities, inventorySize) || !WriteImage(stats, tick))
+		{
+			//la imagen quedo a medias: se rehace completa en la siguiente captura
+			if (!overflowLogged)
+				std::cerr << "Snapshot: " << requiredEntities << " entidades no caben en memoria; sin copias" << std::endl;
+			overflowLogged = true;
+			Clear();
+			return false;
+		}
+		std::cerr << "Snapshot: imagen para " << maxEntities << " entidades (se descartan las copias anteriores)" << std::endl;
+	}
+
+	//hacer lugar: el slot mas viejo se recicla y, si faltan paginas, se sueltan mas
+	if (count == capacity)
+		DropOldest();
+	while (freePages.size() < pageCount && count > 1)
+		DropOldest();
+
+	const Slot* previous = count > 0 ? &slots[SlotIndex(0)] : nullptr;
+	Slot& slot = slots[head];
+	slot.tick = tick;
+	slot.dirtyCount = 0;
+	std::fill(slot.dirty.begin(), slot.dirty.end(), 0);
+
+	for (size_t p = 0; p < pageCount; p++)
+	{
+		const unsigned char* source = staging + p * PAGE_SIZE;
+		if (previous && memcmp(source, Page(previous->pages[p]), PAGE_SIZE) == 0)
+		{
+			//pagina sin cambios: se comparte con la copia anterior
+			slot.pages[p] = previous->pages[p];
+			refCount[slot.pages[p]]++;
+			continue;
+		}
+		uint16_t page = freePages.back();
+		freePages.pop_back();
+		memcpy(Page(page), source, PAGE_SIZE);
+		refCount[page] = 1;
+		slot.pages[p] = page;
+		slot.dirty[p / 64] |= 1ull << (p % 64);
+		slot.dirtyCount++;
+	}
+
+	head = (head + 1) % capacity;
+	count++;
+	lastCaptureMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+	return true;
+}
+
+bool SnapshotRing::Restore(int age, PlayerStats& stats)
+{
+	if (age < 0 || age >= count)
+		return false;
+	auto start = std::chrono::steady_clock::now();
+
+	//la imagen de trabajo es la copia mas nueva: solo se copian las paginas distintas
+	const Slot& newest = slots[SlotIndex(0)];
+	const Slot& target = slots[SlotIndex(age)];
+	for (size_t p = 0; p < pageCount; p++)
+	{
+		if (target.pages[p] != newest.pages[p])
+			memcpy(staging + p * PAGE_SIZE, Page(target.pages[p]), PAGE_SIZE);
+	}
+
+	//las copias posteriores ya no son validas
+	for (int i = 0; i < age; i++)
+	{
+		head = (head - 1 + capacity) % capacity;
+		ReleaseSlot(slots[head]);
+		count--;
+	}
+
+	Header header;
+	memcpy(&header, staging, sizeof(header));
+	if (!RestoreInPlace(header))
+	{
+		const EntityRecord* records = reinterpret_cast<const EntityRecord*>(staging + ENTITIES_OFFSET);
+		const uint32_t* inventory = reinterpret_cast<const uint32_t*>(staging + inventoryOffset);
+		const int32_t* tileMap = reinterpret_cast<const int32_t*>(staging + tileMapOffset);
+		const int32_t* decorMap = reinterpret_cast<const int32_t*>(staging + decorMapOffset);
+
+		//cambiaron las entidades: mismo camino que la carga de partidas
+		WorldState& world = restoreScratch;
+		world.stats = header.stats;
+		world.entities.assign(records, records + header.entityCount);
+		world.inventory.assign(inventory, inventory + header.inventoryCount);
+		world.items.clear();
+		for (uint32_t i = 0; i < header.itemCount; i++)
+		{
+			const Item* item = ItemRegistry::getInstance().Find((int)inventory[header.inventoryCount + i * 2]);
+			if (!item)
+				continue;
+			ItemStackRecord stack = {};
+			strncpy(stack.name, item->name.c_str(), sizeof(stack.name) - 1);
+			stack.count = (int32_t)inventory[header.inventoryCount + i * 2 + 1];
+			world.items.push_back(stack);
+		}
+		world.currentWeapon = header.currentWeapon;
+		world.hasLevel = true;
+		world.tileMap.assign(tileMap, tileMap + MAP_CELLS);
+		world.decorMap.assign(decorMap, decorMap + MAP_CELLS);
+		SaveManager::ApplyWorld(world);
+	}
+	stagedEntities = header.entityCount;
+	stagedInventory = header.inventoryCount + header.itemCount * 2;
+
+	//exacto, no solo hacia arriba: los ids nuevos deben repetirse igual
+	GameObject::nextId = header.nextId;
+	GameRandom::getInstance().SetState(header.rngState);
+	stats = header.stats;
+
+	lastRestoreMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+	return true;
+}
+
+bool SnapshotRing::RestoreInPlace(const Header& header)
+{
+	const EntityRecord* records = reinterpret_cast<const EntityRecord*>(staging + ENTITIES_OFFSET);
+	const uint32_t* inventory = reinterpret_cast<const uint32_t*>(staging + inventoryOffset);
+
+	//los objetos actuales en el mismo orden que WriteImage: mundo, luego armas solo en el inventario
+	restoreObjects.assign(GameObject::gameObjects.begin(), GameObject::gameObjects.end());
+	size_t inWorld = restoreObjects.size();
+	Player* player = nullptr;
+	for (GameObject* obj : GameObject::gameObjects)
+	{
+		if (obj->GetType() == EntityType::Player)
+		{
+			player = static_cast<Player*>(obj);
+			break;
+		}
+	}
+	Inventory* playerInventory = player ? player->GetInventory() : nullptr;
+	uint32_t inventoryCount = 0;
+	uint32_t itemCount = 0;
+	const uint32_t* items = inventory + header.inventoryCount;
+	if (playerInventory)
+	{
+		for (const InventorySlot& slot : *playerInventory)
+		{
+			Weapon* weapon = slot.weapon;
+			if (!weapon)
+			{
+				//los items se comparan igual: no se restauran en su lugar
+				if (itemCount >= header.itemCount || items[itemCount * 2] != (uint32_t)slot.itemId || items[itemCount * 2 + 1] != (uint32_t)slot.count)
+					return false;
+				itemCount++;
+				continue;
+			}
+			//el inventario tambien debe ser el mismo, en el mismo orden
+			if (inventoryCount >= header.inventoryCount || inventory[inventoryCount++] != weapon->id)
+				return false;
+			if (std::find(GameObject::gameObjects.begin(), GameObject::gameObjects.end(), weapon) == GameObject::gameObjects.end())
+				restoreObjects.push_back(weapon);
+		}
+	}
+	if (inventoryCount != header.inventoryCount || itemCount != header.itemCount)
+		return false;
+
+	//los proyectiles van al final de la imagen y no son objetos
+	size_t objectRecords = 0;
+	while (objectRecords < header.entityCount && records[objectRecords].type != EntityType::Projectile)
+		objectRecords++;
+	if (objectRecords != restoreObjects.size())
+		return false;
+	for (size_t i = 0; i < objectRecords; i++)
+	{
+		GameObject* obj = restoreObjects[i];
+		bool recordInWorld = (records[i].flags & ENTITY_IN_WORLD) != 0;
+		if (obj->id != records[i].id || obj->GetType() != records[i].type || recordInWorld != (i < inWorld))
+			return false;
+	}
+
+	//mismas entidades: cada una vuelve a su estado sin crear ni destruir nada
+	for (size_t i = 0; i < objectRecords; i++)
+		restoreObjects[i]->Restore(records[i]);
+	ProjectileSystem& projectiles = ProjectileSystem::getInstance();
+	projectiles.Clear();
+	for (size_t i = objectRecords; i < header.entityCount; i++)
+		projectiles.Restore(records[i]);
+	TrailSystem::getInstance().Clear();
+	if (playerInventory && playerInventory->GetCurrentIndex() != header.currentWeapon)
+		playerInventory->SetCurrentIndex(header.currentWeapon, player);
+
+	//el nivel pudo cambiar despues de la copia mas nueva: se copia siempre (8 KB)
+	Level& level = Level::getInstance();
+	memcpy(level.tileMap, staging + tileMapOffset, MAP_CELLS * sizeof(int32_t));
+	memcpy(level.decorMap, staging + decorMapOffset, MAP_CELLS * sizeof(int32_t));
+	return true;
+}
+
+void SnapshotRing::Clear()
+{
+	while (count > 0)
+		DropOldest();
+	head = 0;
+	memset(staging, 0, pageCount * PAGE_SIZE);
+	stagedEntities = 0;
+	stagedInventory = 0;
+}
+
+uint32_t SnapshotRing::GetTick(int age) const
+{
+	if (age < 0 || age >= count)
+		return 0;
+	return slots[SlotIndex(age)].tick;
+}
+
+int SnapshotRing::GetDirtyPages(int age) const
+{
+	if (age < 0 || age >= count)
+		return 0;
+	return slots[SlotIndex(age)].dirtyCount;
+}
+
+bool SnapshotRing::IsPageDirty(int age, int page) const
+{
+	if (age < 0 || age >= count || page < 0 || page >= (int)pageCount)
+		return false;
+	return (slots[SlotIndex(age)].dirty[page / 64] >> (page % 64)) & 1;
+}
@@ -0,0 +1,130 @@
+#include "TaskScheduler.h"
+#include <chrono>
+
+TaskScheduler* TaskScheduler::instance = nullptr;
+
+using Clock = std::chrono::steady_clock;
+
+static float ElapsedMs(Clock::time_point start)
+{
+	return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+}
+
+TaskId TaskScheduler::Submit(TaskStep step, ETaskPriority priority, const char* name)
+{
+	TaskId id = nextId++;
+	queues[priority].push_back({ id, std::move(step), name ? name : "", 0.0f });
+	return id;
+}
+
+bool TaskScheduler::Cancel(TaskId task)
+{
+	for (std::deque<Task>& queue : queues)
+	{
+		for (auto it = queue.begin(); it != queue.end(); ++it)
+		{
+			if (it->id == task)
+			{
+				queue.erase(it);
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+bool TaskScheduler::IsPending(TaskId task) const
+{
+	for (const std::deque<Task>& queue : queues)
+	{
+		for (const Task& pending : queue)
+		{
+			if (pending.id == task)
+				return true;
+		}
+	}
+	return false;
+}
+
+size_t TaskScheduler::GetQueueDepth() const
+{
+	size_t depth = 0;
+	for (const std::deque<Task>& queue : queues)
+		depth += queue.size();
+	return depth;
+}
+
+float TaskScheduler::RunStep(int priority)
+{
+	//se saca de la cola antes de correr: el paso puede encolar o cancelar otras
+	Task task = std::move(queues[priority].front());
+	queues[priority].pop_front();
+
+	Clock::time_point start = Clock::now();
+	bool done = task.step();
+	float ms = ElapsedMs(start);
+	task.lastMs = ms;
+
+	if (ms > worstStepMs)
+	{
+		worstStepMs = ms;
+		worstStepName = task.name;
+	}
+	if (done)
+		completedCount++;
+	else
+		queues[priority].push_back(std::move(task)); //turno para las demas de su prioridad
+	lastFrameSteps++;
+	return ms;
+}
+
+void TaskScheduler::RunFrame()
+{
+	Clock::time_point start = Clock::now();
+	lastFrameSteps = 0;
+	bool ran[TASK_PRIORITY_COUNT] = {};
+
+	//la cola mas olvidada recibe un paso primero
+	for (int p = TASK_PRIORITY_COUNT - 1; p > 0; p--)
+	{
+		if (!queues[p].empty() && starvedFrames[p] >= STARVATION_FRAMES)
+		{
+			RunStep(p);
+			ran[p] = true;
+			break;
+		}
+	}
+
+	//por prioridad mientras quepa el siguiente paso (siempre al menos uno);
+	//si no cabe, una tarea mas barata de menor prioridad aun puede entrar
+	for (int p = 0; p < TASK_PRIORITY_COUNT; p++)
+	{
+		while (!queues[p].empty())
+		{
+			if (lastFrameSteps > 0 && ElapsedMs(start) + queues[p].front().lastMs > budgetMs)
+				break;
+			RunStep(p);
+			ran[p] = true;
+		}
+	}
+
+	for (int p = 0; p < TASK_PRIORITY_COUNT; p++)
+		starvedFrames[p] = (ran[p] || queues[p].empty()) ? 0 : starvedFrames[p] + 1;
+
+	lastFrameMs = ElapsedMs(start);
+	if (lastFrameSteps > 0 && lastFrameMs > budgetMs)
+		overrunFrames++;
+}
+
+void TaskScheduler::Flush()
+{
+	//un paso puede encolar mas trabajo de cualquier prioridad
+	while (GetQueueDepth() > 0)
+	{
+		for (int p = 0; p < TASK_PRIORITY_COUNT; p++)
+		{
+			while (!queues[p].empty())
+				RunStep(p);
+		}
+	}
+}
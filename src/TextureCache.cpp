@@ -0,0 +1,51 @@
+#include "TextureCache.h"
+#include <iostream>
+
+std::unordered_map<std::string, Texture2D> TextureCache::textures;
+std::unordered_map<unsigned int, std::string> TextureCache::paths;
+std::mutex TextureCache::mutex;
+std::thread::id TextureCache::glThread;
+
+Texture2D TextureCache::Load(const std::string& path)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	auto it = textures.find(path);
+	if (it != textures.end())
+		return it->second;
+
+	if (glThread == std::thread::id())
+		glThread = std::this_thread::get_id();
+	else if (glThread != std::this_thread::get_id())
+	{
+		//fuera del hilo de OpenGL no se puede subir a la GPU (hay que precargarla)
+		std::cerr << "TextureCache: " << path << " no precargada" << std::endl;
+		return Texture2D{ 0 };
+	}
+
+	Texture2D texture = LoadTexture(path.c_str());
+	textures[path] = texture;
+	if (texture.id != 0)
+		paths[texture.id] = path;
+	return texture;
+}
+
+const char* TextureCache::PathOf(const Texture2D& texture)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	auto it = paths.find(texture.id);
+	if (it == paths.end())
+		return "";
+	return it->second.c_str();
+}
+
+void TextureCache::UnloadAll()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	for (auto& entry : textures)
+	{
+		if (entry.second.id != 0)
+			UnloadTexture(entry.second);
+	}
+	textures.clear();
+	paths.clear();
+}
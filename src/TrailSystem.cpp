@@ -0,0 +1,165 @@
+#include "TrailSystem.h"
+#include "GameObject.h"
+#include <cmath>
+#include <iostream>
+
+using namespace Quetz_LabEDC;
+
+TrailSystem* TrailSystem::instance = nullptr;
+
+int TrailSystem::Join(GameObject* leader, GameObject* follower, TrailId& trail)
+{
+	//una entrada por lider; las que quedaron sin seguidores se reusan
+	TrailId id = INVALID_TRAIL;
+	for (size_t i = 0; i < trails.size(); i++)
+	{
+		if (trails[i].leader == leader)
+		{
+			id = (TrailId)i;
+			break;
+		}
+		if (!trails[i].leader && id == INVALID_TRAIL)
+			id = (TrailId)i;
+	}
+	if (id == INVALID_TRAIL)
+	{
+		id = (TrailId)trails.size();
+		trails.emplace_back();
+	}
+	Trail& entry = trails[id];
+	if (entry.leader != leader)
+	{
+		entry.leader = leader;
+		entry.count = 0;
+		entry.slots.clear();
+		entry.followers = 0;
+	}
+
+	int slot = 0;
+	while (slot < (int)entry.slots.size() && entry.slots[slot])
+		slot++;
+	if (slot >= GetMaxFollowers())
+	{
+		//su punto quedaria mas atras de lo que guarda el rastro: nunca llegaria
+		std::cerr << "TrailSystem: fila llena (max " << GetMaxFollowers() << ")" << std::endl;
+		if (entry.followers == 0)
+			entry.leader = nullptr;
+		trail = INVALID_TRAIL;
+		return -1;
+	}
+	if (slot == (int)entry.slots.size())
+		entry.slots.push_back(nullptr);
+	entry.slots[slot] = follower;
+	entry.followers++;
+	trail = id;
+	return slot;
+}
+
+int TrailSystem::GetMaxFollowers() const
+{
+	//el ultimo punto debe quedar antes de la muestra mas vieja:
+	//(lugar + 1) * followGap < (MAX_SAMPLES - 1) * SAMPLE_SPACING
+	return (int)ceilf((MAX_SAMPLES - 1) * SAMPLE_SPACING / followGap) - 1;
+}
+
+void TrailSystem::Leave(TrailId trail, int slot)
+{
+	if (trail >= trails.size())
+		return;
+	Trail& entry = trails[trail];
+	if (slot < 0 || slot >= (int)entry.slots.size() || !entry.slots[slot])
+		return;
+	entry.slots[slot] = nullptr;
+	if (--entry.followers == 0)
+		entry.leader = nullptr;
+}
+
+void TrailSystem::Restart(Trail& trail)
+{
+	trail.head = 0;
+	trail.count = 1;
+	trail.samples[0] = trail.leader->position;
+}
+
+void TrailSystem::Push(Trail& trail, Vector2 sample)
+{
+	trail.head = (trail.head + 1) % MAX_SAMPLES;
+	trail.samples[trail.head] = sample;
+	if (trail.count < MAX_SAMPLES)
+		trail.count++;
+}
+
+void TrailSystem::Update()
+{
+	for (Trail& trail : trails)
+	{
+		if (!trail.leader)
+			continue;
+		if (trail.count == 0)
+		{
+			Restart(trail);
+			continue;
+		}
+
+		//muestras cada SAMPLE_SPACING px sobre el tramo que recorrio este tick
+		Vector2 last = trail.samples[trail.head];
+		float dx = trail.leader->position.x - last.x;
+		float dy = trail.leader->position.y - last.y;
+		float distance = sqrtf(dx * dx + dy * dy);
+		if (distance < SAMPLE_SPACING)
+			continue;
+		if (distance > SAMPLE_SPACING * MAX_SAMPLES)
+		{
+			//salto (teletransporte, carga): el camino viejo ya no sirve
+			Restart(trail);
+			continue;
+		}
+		float stepX = dx / distance * SAMPLE_SPACING;
+		float stepY = dy / distance * SAMPLE_SPACING;
+		for (; distance >= SAMPLE_SPACING; distance -= SAMPLE_SPACING)
+		{
+			last.x += stepX;
+			last.y += stepY;
+			Push(trail, last);
+		}
+	}
+}
+
+bool TrailSystem::GetSlotPoint(TrailId trail, int slot, Vector2& point) const
+{
+	if (trail >= trails.size())
+		return false;
+	const Trail& entry = trails[trail];
+	if (!entry.leader || entry.count == 0)
+		return false;
+
+	float behind = (slot + 1) * followGap;
+	Vector2 leader = entry.leader->position;
+	Vector2 newest = entry.samples[entry.head];
+	float dx = newest.x - leader.x, dy = newest.y - leader.y;
+	float first = sqrtf(dx * dx + dy * dy);
+	if (behind <= first)
+	{
+		//entre el lider y la muestra mas nueva
+		float t = behind / first;
+		point = { leader.x + dx * t, leader.y + dy * t };
+		return true;
+	}
+
+	//las muestras estan a SAMPLE_SPACING: el indice sale directo de la distancia
+	float along = (behind - first) / SAMPLE_SPACING;
+	size_t k = (size_t)along;
+	if (k + 1 >= entry.count)
+		return false;
+	Vector2 a = entry.samples[(entry.head + MAX_SAMPLES - k) % MAX_SAMPLES];
+	Vector2 b = entry.samples[(entry.head + MAX_SAMPLES - k - 1) % MAX_SAMPLES];
+	float t = along - (float)k;
+	point = { a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t };
+	return true;
+}
+
+void TrailSystem::Clear()
+{
+	for (Trail& trail : trails)
+		trail.count = 0;
+}
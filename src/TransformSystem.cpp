@@ -0,0 +1,262 @@
+#include "TransformSystem.h"
+#include "GameObject.h"
+#include "raymath.h"
+
+using namespace Quetz_LabEDC;
+
+TransformSystem* TransformSystem::instance = nullptr;
+
+static constexpr uint32_t NO_SLOT = 0xFFFFFFFFu;
+
+TransformSystem::Node* TransformSystem::Find(TransformId node)
+{
+	if (node >= slotOf.size() || slotOf[node] == NO_SLOT)
+		return nullptr;
+	return &nodes[slotOf[node]];
+}
+
+const TransformSystem::Node* TransformSystem::Find(TransformId node) const
+{
+	if (node >= slotOf.size() || slotOf[node] == NO_SLOT)
+		return nullptr;
+	return &nodes[slotOf[node]];
+}
+
+Vector2 TransformSystem::ParentWorld(const Node& node) const
+{
+	const Node* parent = Find(node.parent);
+	return parent ? parent->world : Vector2{ 0, 0 };
+}
+
+TransformId TransformSystem::Create(Vector2 local, TransformId parent)
+{
+	TransformId id;
+	if (!freeIds.empty())
+	{
+		id = freeIds.back();
+		freeIds.pop_back();
+	}
+	else
+	{
+		id = (TransformId)slotOf.size();
+		slotOf.push_back(NO_SLOT);
+	}
+
+	const Node* parentNode = Find(parent);
+	Node node = {};
+	node.local = local;
+	node.id = id;
+	node.parent = parentNode ? parent : INVALID_TRANSFORM;
+	node.parentSlot = parentNode ? slotOf[parent] : NO_SLOT;
+	//el mundo queda listo desde ya, sin esperar al siguiente Update
+	node.world = Vector2Add(parentNode ? parentNode->world : Vector2{ 0, 0 }, local);
+	node.object = nullptr;
+	node.flags = 0;
+
+	//al final siempre queda despues de su padre: el orden sigue valido
+	slotOf[id] = (uint32_t)nodes.size();
+	nodes.push_back(node);
+	return id;
+}
+
+void TransformSystem::Destroy(TransformId node)
+{
+	Node* target = Find(node);
+	if (!target)
+		return;
+	if (target->object)
+		target->object->transform = INVALID_TRANSFORM;
+
+	//un recorrido: los hijos directos quedan como raices (sus subarboles siguen en orden)
+	for (Node& child : nodes)
+	{
+		if (child.parent != node)
+			continue;
+		child.parent = INVALID_TRANSFORM;
+		child.parentSlot = NO_SLOT;
+		child.local = child.world;
+		child.flags |= NODE_DIRTY;
+	}
+
+	//el ultimo ocupa el hueco; el orden se rehace en el siguiente Update
+	uint32_t slot = slotOf[node];
+	uint32_t last = (uint32_t)nodes.size() - 1;
+	if (slot != last)
+	{
+		nodes[slot] = nodes[last];
+		slotOf[nodes[slot].id] = slot;
+		orderDirty = true;
+	}
+	nodes.pop_back();
+	slotOf[node] = NO_SLOT;
+	freeIds.push_back(node);
+}
+
+void TransformSystem::CheckOrder(const Node& node)
+{
+	if (orderDirty || node.parent == INVALID_TRANSFORM)
+		return;
+	uint32_t parentSlot = slotOf[node.parent];
+	if (parentSlot > slotOf[node.id])
+		orderDirty = true;
+	else
+		nodes[slotOf[node.id]].parentSlot = parentSlot;
+}
+
+void TransformSystem::SetParent(TransformId node, TransformId parent, bool keepWorld)
+{
+	Node* target = Find(node);
+	if (!target || target->parent == parent || parent == node)
+		return;
+	//no se permite colgar un nodo de su propio subarbol
+	for (const Node* p = Find(parent); p; p = Find(p->parent))
+	{
+		if (p->id == node)
+			return;
+	}
+
+	target->parent = Find(parent) ? parent : INVALID_TRANSFORM;
+	if (keepWorld)
+		target->local = Vector2Subtract(target->world, ParentWorld(*target));
+	target->flags |= NODE_DIRTY;
+	target->parentSlot = NO_SLOT;
+	CheckOrder(*target);
+}
+
+void TransformSystem::SetLocal(TransformId node, Vector2 local)
+{
+	if (Node* target = Find(node))
+	{
+		target->local = local;
+		target->flags |= NODE_DIRTY;
+	}
+}
+
+Vector2 TransformSystem::GetLocal(TransformId node) const
+{
+	const Node* target = Find(node);
+	return target ? target->local : Vector2{ 0, 0 };
+}
+
+Vector2 TransformSystem::GetWorld(TransformId node) const
+{
+	const Node* target = Find(node);
+	return target ? target->world : Vector2{ 0, 0 };
+}
+
+TransformId TransformSystem::GetParent(TransformId node) const
+{
+	const Node* target = Find(node);
+	return target ? target->parent : INVALID_TRANSFORM;
+}
+
+TransformId TransformSystem::Bind(GameObject* obj)
+{
+	if (obj->transform != INVALID_TRANSFORM)
+		return obj->transform;
+	TransformId id = Create(obj->position);
+	Find(id)->object = obj;
+	obj->transform = id;
+	return id;
+}
+
+void TransformSystem::Attach(GameObject* child, GameObject* parent, Vector2 offset)
+{
+	TransformId node = Bind(child);
+	SetParent(node, Bind(parent));
+	SetLocal(node, offset);
+}
+
+void TransformSystem::Detach(GameObject* child)
+{
+	if (child->transform != INVALID_TRANSFORM)
+		SetParent(child->transform, INVALID_TRANSFORM, true);
+}
+
+void TransformSystem::Release(GameObject* obj)
+{
+	Destroy(obj->transform);
+	obj->transform = INVALID_TRANSFORM;
+}
+
+void TransformSystem::Reorder()
+{
+	//indice de hijos por posicion del padre (conteo), todo en O(n)
+	uint32_t count = (uint32_t)nodes.size();
+	childStart.assign(count + 1, 0);
+	for (const Node& node : nodes)
+	{
+		if (node.parent != INVALID_TRANSFORM)
+			childStart[slotOf[node.parent] + 1]++;
+	}
+	for (uint32_t i = 0; i < count; i++)
+		childStart[i + 1] += childStart[i];
+	childSlots.resize(childStart[count]);
+	std::vector<uint32_t>& cursor = visitOrder; //se reutiliza antes de llenarlo con el orden
+	cursor.assign(childStart.begin(), childStart.end() - 1);
+	for (uint32_t i = 0; i < count; i++)
+	{
+		if (nodes[i].parent != INVALID_TRANSFORM)
+			childSlots[cursor[slotOf[nodes[i].parent]]++] = i;
+	}
+
+	//por niveles desde las raices: cada padre sale antes que sus hijos
+	visitOrder.clear();
+	for (uint32_t i = 0; i < count; i++)
+	{
+		if (nodes[i].parent == INVALID_TRANSFORM)
+			visitOrder.push_back(i);
+	}
+	for (size_t k = 0; k < visitOrder.size(); k++)
+	{
+		uint32_t slot = visitOrder[k];
+		for (uint32_t c = childStart[slot]; c < childStart[slot + 1]; c++)
+			visitOrder.push_back(childSlots[c]);
+	}
+
+	sortScratch.resize(count);
+	for (uint32_t i = 0; i < count; i++)
+		sortScratch[i] = nodes[visitOrder[i]];
+	nodes.swap(sortScratch);
+
+	for (uint32_t i = 0; i < nodes.size(); i++)
+		slotOf[nodes[i].id] = i;
+	for (Node& node : nodes)
+		node.parentSlot = node.parent != INVALID_TRANSFORM ? slotOf[node.parent] : NO_SLOT;
+	orderDirty = false;
+}
+
+void TransformSystem::Update()
+{
+	if (orderDirty)
+		Reorder();
+
+	size_t updated = 0;
+	Node* data = nodes.data();
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+		Node& node = data[i];
+		bool root = node.parentSlot == NO_SLOT;
+
+		//una raiz ligada sigue al objeto (el objeto se mueve solo)
+		if (root && node.object && (node.local.x != node.object->position.x || node.local.y != node.object->position.y))
+		{
+			node.local = node.object->position;
+			node.flags |= NODE_DIRTY;
+		}
+
+		bool parentChanged = !root && (data[node.parentSlot].flags & NODE_CHANGED);
+		if (!(node.flags & NODE_DIRTY) && !parentChanged)
+		{
+			node.flags &= ~NODE_CHANGED;
+			continue;
+		}
+
+		node.world = root ? node.local : Vector2Add(data[node.parentSlot].world, node.local);
+		node.flags = NODE_CHANGED;
+		if (!root && node.object)
+			node.object->position = node.world;
+		updated++;
+	}
+	lastUpdated = updated;
+}
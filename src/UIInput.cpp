@@ -0,0 +1,158 @@
+#include "UIInput.h"
+#include "InputSystem.h"
+
+void UIInputDispatcher::Sample()
+{
+	//el mouse sale del tick de entrada, asi los botones tambien se repiten
+	const InputSystem& input = InputSystem::getInstance();
+	state.mouse = input.GetMouse();
+	state.mousePressed = input.IsMouse(MOUSE_STATE_PRESSED);
+	state.mouseReleased = input.IsMouse(MOUSE_STATE_RELEASED);
+	state.mouseDown = input.IsMouse(MOUSE_STATE_DOWN);
+
+	state.keyCount = 0;
+	if (input.IsReplaying())
+		return; //el texto tecleado no se graba
+	int key = GetKeyPressed();
+	while (key != 0 && state.keyCount < UIInputState::MAX_KEYS)
+	{
+		state.keys[state.keyCount++] = key;
+		key = GetKeyPressed();
+	}
+}
+
+int UIInputDispatcher::CellOf(float x, float y) const
+{
+	int cx = (int)(x / CELL_SIZE);
+	int cy = (int)(y / CELL_SIZE);
+	if (cx < 0 || cy < 0 || cx >= cols || cy >= rows)
+		return -1;
+	return cy * cols + cx;
+}
+
+bool UIInputDispatcher::IndexStale(const std::vector<View*>& views) const
+{
+	//primero lo barato; los rects solo se leen si la lista es la misma (y siguen vivas)
+	if (indexDirty || GetScreenWidth() != indexedWidth || GetScreenHeight() != indexedHeight || views != indexedViews)
+		return true;
+	for (size_t i = 0; i < entries.size(); i++)
+	{
+		const Rectangle& rect = entries[i]->rect;
+		const Rectangle& indexed = indexedRects[i];
+		if (rect.x != indexed.x || rect.y != indexed.y || rect.width != indexed.width || rect.height != indexed.height)
+			return true;
+	}
+	return false;
+}
+
+void UIInputDispatcher::Rebuild(const std::vector<View*>& views)
+{
+	indexedWidth = GetScreenWidth();
+	indexedHeight = GetScreenHeight();
+	cols = indexedWidth / CELL_SIZE + 1;
+	rows = indexedHeight / CELL_SIZE + 1;
+	int cellCount = cols * rows;
+
+	entries.clear();
+	indexedRects.clear();
+	for (View* view : views)
+	{
+		if (view->IsInteractive())
+		{
+			entries.push_back(view);
+			indexedRects.push_back(view->rect);
+		}
+	}
+
+	//primera pasada: contar cuantas vistas tocan cada celda
+	cellStart.assign(cellCount + 1, 0);
+	for (View* view : entries)
+	{
+		int x0 = (int)(view->rect.x / CELL_SIZE), x1 = (int)((view->rect.x + view->rect.width) / CELL_SIZE);
+		int y0 = (int)(view->rect.y / CELL_SIZE), y1 = (int)((view->rect.y + view->rect.height) / CELL_SIZE);
+		for (int y = (y0 < 0 ? 0 : y0); y <= y1 && y < rows; y++)
+			for (int x = (x0 < 0 ? 0 : x0); x <= x1 && x < cols; x++)
+				cellStart[y * cols + x + 1]++;
+	}
+	for (int c = 0; c < cellCount; c++)
+		cellStart[c + 1] += cellStart[c];
+
+	//segunda pasada: llenar los indices
+	cellItems.assign(cellStart[cellCount], 0);
+	std::vector<int> fill(cellStart.begin(), cellStart.end() - 1);
+	for (int i = 0; i < (int)entries.size(); i++)
+	{
+		View* view = entries[i];
+		int x0 = (int)(view->rect.x / CELL_SIZE), x1 = (int)((view->rect.x + view->rect.width) / CELL_SIZE);
+		int y0 = (int)(view->rect.y / CELL_SIZE), y1 = (int)((view->rect.y + view->rect.height) / CELL_SIZE);
+		for (int y = (y0 < 0 ? 0 : y0); y <= y1 && y < rows; y++)
+			for (int x = (x0 < 0 ? 0 : x0); x <= x1 && x < cols; x++)
+				cellItems[fill[y * cols + x]++] = i;
+	}
+
+	indexedViews = views;
+	indexDirty = false;
+}
+
+View* UIInputDispatcher::HitTest(Vector2 point) const
+{
+	int cell = CellOf(point.x, point.y);
+	if (cell < 0)
+		return nullptr;
+
+	View* best = nullptr;
+	int bestIndex = -1;
+	for (int i = cellStart[cell]; i < cellStart[cell + 1]; i++)
+	{
+		int index = cellItems[i];
+		View* view = entries[index];
+		if (!view->visible || !CheckCollisionPointRec(point, view->rect))
+			continue;
+		//a igual zOrder gana la que se agrego despues (se dibuja encima)
+		if (best == nullptr || view->zOrder > best->zOrder || (view->zOrder == best->zOrder && index > bestIndex))
+		{
+			best = view;
+			bestIndex = index;
+		}
+	}
+	return best;
+}
+
+void UIInputDispatcher::Dispatch(const std::vector<View*>& views)
+{
+	if (IndexStale(views))
+		Rebuild(views);
+
+	View* hit = HitTest(state.mouse);
+
+	if (hit != hovered)
+	{
+		if (hovered)
+			hovered->onMouseExit();
+		if (hit)
+			hit->onMouseEnter();
+		hovered = hit;
+	}
+
+	if (state.mousePressed)
+	{
+		focused = hit;
+		if (hit)
+			hit->onMouseClick();
+	}
+
+	if (focused)
+	{
+		for (int i = 0; i < state.keyCount; i++)
+			focused->onKeyPressed(state.keys[i]);
+	}
+}
+
+void UIInputDispatcher::Forget(View* view)
+{
+	if (hovered == view)
+		hovered = nullptr;
+	if (focused == view)
+		focused = nullptr;
+	Invalidate();
+}
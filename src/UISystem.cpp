@@ -7,7 +7,7 @@ UISystem* UISystem::instance = nullptr; // Inicializar el puntero est
 Label* UISystem::createLabel(const char* text, int x, int y, int fontSize)
 {
 	Label* label = new Label();
-	label->text = text;
+	label->SetText(text);
 	label->rect.x = x;
 	label->rect.y = y;
 	label->fontSize = fontSize;
@@ -15,17 +15,53 @@ Label* UISystem::createLabel(const char* text, int x, int y, int fontSize)
 	return label;
 }
 
+Label* UISystem::createLabel(Panel* panel, const char* text, int x, int y, int fontSize)
+{
+	Label* label = new Label();
+	label->SetText(text);
+	label->rect.x = x;
+	label->rect.y = y;
+	label->fontSize = fontSize;
+	panel->AddChild(label);
+	return label;
+}
+
+Panel* UISystem::createPanel(int x, int y)
+{
+	Panel* panel = new Panel(x, y);
+	views.push_back(panel);
+	return panel;
+}
+
 void UISystem::draw()
 {
 	for (View* view : views)
 	{
 		if (view->visible)
+		{
+			view->Refresh(); //layout solo si algo cambio
 			view->draw();
+		}
+	}
+	drawImWidgets();
+}
+
+void UISystem::SampleInput()
+{
+	//el primero que lo necesite en el frame lee mouse y teclado
+	if (sampledFrame != imFrame)
+	{
+		input.Sample();
+		sampledFrame = imFrame;
 	}
 }
 
 void UISystem::update()
 {
+	SampleInput();
+	//hover y clic solo llegan a la vista bajo el mouse
+	input.Dispatch(views);
+
 	for (View* view : views)
 	{
 		if (view->visible)
@@ -33,24 +69,85 @@ void UISystem::update()
 	}
 }
 
+// hash FNV-1a de 32 bits para los IDs de los widgets
+static uint32_t HashWidgetId(const char* id)
+{
+	uint32_t hash = 2166136261u;
+	while (*id)
+	{
+		hash ^= (unsigned char)*id++;
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+UISystem::ImWidget& UISystem::GetImWidget(const char* id)
+{
+	uint32_t hash = HashWidgetId(id);
+	auto it = imWidgetIndex.find(hash);
+	if (it != imWidgetIndex.end())
+		return imWidgets[it->second];
+
+	//primera vez que se declara: se crea su estado y se reutiliza desde ahora
+	ImWidget widget = {};
+	widget.id = hash;
+	widget.fontSize = 20;
+	imWidgetIndex[hash] = (int)imWidgets.size();
+	imWidgets.push_back(widget);
+	return imWidgets.back();
+}
+
+bool UISystem::DoButton(const char* id, const char* text, int x, int y, int w, int h, Color color)
+{
+	ImWidget& widget = GetImWidget(id);
+	widget.rect = { (float)x, (float)y, (float)w, (float)h };
+	widget.color = color;
+	widget.lastFrame = imFrame;
+	if (widget.text != text)
+		widget.text = text; //solo copia si el texto cambio
+
+	SampleInput();
+	const UIInputState& state = input.GetState();
+	widget.hovered = CheckCollisionPointRec(state.mouse, widget.rect);
+	if (widget.hovered && state.mousePressed)
+	{
+		//los widgets inmediatos se dibujan encima, el clic ya no baja a las views
+		input.ConsumeClick();
+		return true;
+	}
+	return false;
+}
+
+void UISystem::drawImWidgets()
+{
+	//solo se dibujan los widgets declarados en este frame
+	for (const ImWidget& widget : imWidgets)
+	{
+		if (widget.lastFrame != imFrame)
+			continue;
+
+		DrawRectangle(widget.rect.x, widget.rect.y, widget.rect.width, widget.rect.height, widget.hovered ? ColorBrightness(widget.color, 0.2f) : widget.color);
+		DrawText(widget.text.c_str(), widget.rect.x + 10, widget.rect.y + 10, widget.fontSize, WHITE);
+	}
+	imFrame++;
+}
+
 void UISystem::InitHUD(int health, int level, int energy) {
-	healthLabel = createLabel(("Vida: " + std::to_string(health)).c_str(), 50, 30);
-	
-	levelLabel = createLabel(("Nivel: " + std::to_string(level)).c_str(), 50, 60);
-	energyLabel = createLabel(("Energa: " + std::to_string(energy)).c_str(), 50, 90);
+	//etiquetas ligadas a su valor, dentro de un panel con cache
+	hudPanel = createPanel(50, 30);
+	healthLabel = createLabel(hudPanel, "", 50, 30);
+	healthLabel->Bind("Health: %i", health);
+	levelLabel = createLabel(hudPanel, "", 50, 60);
+	levelLabel->Bind("Level: %i", level);
+	energyLabel = createLabel(hudPanel, "", 50, 90);
+	energyLabel->Bind("Energy: %i", energy);
 }
 
 void UISystem::UpdateHUD(int health, int level, int energy) 
 {
-	
-	sprintf(buffer, "Health: %i", health);
-	healthLabel->text = buffer;
-	sprintf(buffer2, "Level: %i", level);
-	levelLabel->text = buffer2;
-	sprintf(buffer3, "Energy: %i", energy);
-	energyLabel->text = buffer3;
-	//healthLabel->text = ("Health: " + std::to_string(health)).c_str();
-	/*levelLabel->text = ("Level: " + std::to_string(level)).c_str();
-	energyLabel->text = ("Energy: " + std::to_string(energy)).c_str();*/
+	//solo se re-formatea (y se redibuja el panel) si el valor cambio
+	healthLabel->SetValue(health);
+	levelLabel->SetValue(level);
+	energyLabel->SetValue(energy);
 }
 
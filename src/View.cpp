@@ -1 +1,7 @@
 #include "View.h"
+#include "UISystem.h"
+
+View::~View()
+{
+	UISystem::getInstance().GetInput().Forget(this);
+}
@@ -1,3 +1,25 @@
 #include "Weapon.h"
+#include "Player.h"
 
-using namespace Quetz_LabEDC;
\ No newline at end of file
+using namespace Quetz_LabEDC;
+
+void Weapon::Capture(EntityRecord& record) const
+{
+	GameObject::Capture(record);
+	record.vector = offset;
+	record.ownerId = owner ? owner->id : 0;
+}
+
+float Weapon::GetDepth() const
+{
+	if (owner)
+		return owner->GetDepth() + 0.5f;
+	return position.y + 64; //mismo recorte que draw()
+}
+
+void Weapon::Restore(const EntityRecord& record)
+{
+	GameObject::Restore(record);
+	offset = record.vector;
+	//el owner lo resuelve SaveManager cuando ya existen todos los objetos
+}
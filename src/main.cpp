@@ -2,6 +2,7 @@
 #include <iostream>	// for std::cout, std::endl
 #include <string>	// for std::string
 #include <vector>	// for std::vector
+#include <algorithm>	// for std::max
 #include "Player.h"	// utility header for Player class
 #include "sideKick.h"	// utility header for sideKick class
 #include "raylib.h"
@@ -11,10 +12,32 @@
 #include "Button.h"	// utility header for Button class
 #include "Enemy.h"	// utility header for Enemy class
 #include "Weapon.h"	// utility header for Weapon class
-#include "Projectile.h"	// utility header for Projectile class
+#include "ProjectileSystem.h"	// proyectiles en arreglos (SoA)
+#include "ParticleSystem.h"	// efectos de particulas
+#include "CrowdSystem.h"	// movimiento de hordas
+#include "TrailSystem.h"	// fila de sidekicks sobre el rastro del jugador
 #include "Level.h"
 #include "Singleton.h"
 #include "LinkedList.h"
+#include "FrameArena.h"
+#include "TextureCache.h"
+#include "AutosaveService.h"
+#include "SaveIndex.h"
+#include "LoadMenu.h"
+#include "InputSystem.h"
+#include "GameRandom.h"
+#include "SnapshotRing.h"
+#include "PrefabDatabase.h"
+#include "AnimationSystem.h"
+#include "RenderQueue.h"
+#include "AIScheduler.h"
+#include "TaskScheduler.h"
+#include "QualityGovernor.h"
+#include "SettingsMenu.h"
+#include "SimulationThread.h"
+#include "RenderSnapshot.h"
+#include <filesystem>
+#include <cstring>
 
 using namespace Quetz_LabEDC;
 
@@ -85,8 +108,36 @@ public:
 		}
 	}
 };
-int main()
+int main(int argc, char** argv)
 {
+	// modo de medicion: --bench-json <archivo> [iteraciones], sin abrir ventana
+	if (argc >= 3 && std::string(argv[1]) == "--bench-json")
+	{
+		int iterations = argc >= 4 ? std::max(1, atoi(argv[3])) : 20;
+		SaveManager::BenchmarkJsonLoad(argv[2], iterations);
+		return 0;
+	}
+	// sesiones reproducibles: --record <archivo> [semilla] / --replay <archivo>
+	// (rutas absolutas: el directorio de trabajo cambia a resources mas abajo)
+	for (int i = 1; i + 1 < argc; i++)
+	{
+		std::string arg = argv[i];
+		std::string path = std::filesystem::absolute(argv[i + 1]).string();
+		if (arg == "--record")
+		{
+			uint64_t seed = (i + 2 < argc) ? strtoull(argv[i + 2], nullptr, 10) : GameRandom::getInstance().GetSeed();
+			InputSystem::getInstance().StartRecording(path, seed);
+			std::cout << "Grabando entrada en " << path << " (semilla " << seed << ")" << std::endl;
+		}
+		else if (arg == "--replay" && !InputSystem::getInstance().StartReplay(path))
+		{
+			return 1;
+		}
+	}
+	bool replaying = InputSystem::getInstance().IsReplaying();
+	// con grabacion o repeticion la calidad no cambia sola: la simulacion debe ser la misma
+	QualityGovernor::getInstance().SetLocked(replaying || InputSystem::getInstance().IsRecording());
+	double replayFrameMs = 0.0, replayWorstMs = 0.0; // tiempos reales durante la repeticion
 
 	int health = 100;
 	int level = 1;
@@ -94,6 +145,12 @@ int main()
 	UISystem::getInstance().InitHUD(health, level, energy);
 	
 	int currentEra = 0;  // 0: Prehistoria, 1: Edad Media, 2: Futuro...
+	float playTime = 0.0f; // segundos jugados, se guarda con la partida
+	int pendingSaveSlot = -1; // el guardado se copia al final del tick; la miniatura al dibujarlo
+	LoadMenu loadMenu;
+	SettingsMenu settingsMenu; // Configuracion del menu principal
+	SnapshotRing history; // ultimo segundo de ticks para retroceder
+	SnapshotRing quickSnapshot(1); // guardado rapido en memoria para reintentar
 	// Tell the window to use vsync and work on high DPI displays
 	SetConfigFlags(FLAG_VSYNC_HINT | FLAG_WINDOW_HIGHDPI);
 	std::cout << "Inicializando sistema de juego..." << std::endl;
@@ -142,37 +199,37 @@ int main()
 	//std::vector<GameObject*> gameObjects;
 	Texture2D hudBar = LoadTexture("HealthBar(Frame).png");
 	SetTextureFilter(hudBar, TEXTURE_FILTER_POINT); // Evita desenfoque en escalado
-	GameObject* myObj = new GameObject({ 200,200 }, "myObj", LoadTexture("mono.png"));
-	myObj->DisplayName = true;
+	// definiciones de entidades e items; despues de la primera vez se leen del cache binario
+	if (!PrefabDatabase::getInstance().Load("prefabs.json", "prefabs.bin")) {
+		CloseWindow();
+		return 1;
+	}
+	PrefabDatabase& prefabs = PrefabDatabase::getInstance();
+
+	// efectos de particulas (solo visuales): impactos, apariciones y armas recogidas
+	ParticleSystem& particles = ParticleSystem::getInstance();
+	//                                                  textura pool rafaga velocidad     vida        gravedad lado color inicial        color final
+	EmitterId impactEmitter = particles.AddEmitter("impacto", { { 0 }, 1024, 24, 60.0f, 220.0f, 0.2f, 0.5f, 300.0f, 3.0f, { 255, 220, 80, 255 }, { 255, 60, 0, 0 } });
+	EmitterId spawnEmitter = particles.AddEmitter("aparicion", { { 0 }, 1024, 40, 20.0f, 90.0f, 0.4f, 0.9f, -40.0f, 5.0f, { 170, 80, 255, 220 }, { 40, 0, 80, 0 } });
+	particles.AddEmitter("recoger", { { 0 }, 512, 32, 40.0f, 140.0f, 0.3f, 0.7f, 0.0f, 3.0f, { 255, 255, 160, 255 }, { 255, 200, 0, 0 } });
+
+	GameObject* myObj = prefabs.Spawn("myObj");
 	//push_back agrega un elemento al final del arreglo
 	GameObject::gameObjects.push_back(myObj);  //cast implicito a GameObject*
 
-	//El jugador
-	// este constructor ya no existe, ahora el Player establece su textura
-	//Player* playerCharacter = new Player({ 0,0 }, "Player1", LoadTexture("boy.png"));
-	Player* playerCharacter = new Player({ 270,480 }, "Player1");
-	playerCharacter->start(); // Inicializar el jugador
-	playerCharacter->speed = 200.0f;
+	//El jugador (velocidad y posicion vienen del prefab)
+	Player* playerCharacter = static_cast<Player*>(prefabs.Spawn("Player1"));
 	//agregando el player pero con un cast explicito estatico
 	// estatico quiere decir que se realiza en tiempo de compilacion
 	GameObject::gameObjects.push_back(static_cast<GameObject*>(playerCharacter));
 
 	//prueba de arma
-	Weapon* w = new Weapon({ 500, 500 }, "Sword", LoadTexture("sword.png"));
+	Weapon* w = static_cast<Weapon*>(prefabs.Spawn("Sword"));
 	//playerCharacter->SetWeapon(w); //asignar el arma al jugador
 	GameObject::gameObjects.push_back(w); //agregar el arma al arreglo de gameobjects
 
-	sideKick* sidekick = new sideKick({ 500,0 }, "Foo", LoadTexture("sidekick.png"));
-	sidekick->owner = playerCharacter;
-	sidekick->DisplayName = true;
-	sidekick->speed = 199.0f;
-	GameObject::gameObjects.push_back(sidekick);
-
-	sideKick* sidekick2 = new sideKick({ 800,600 }, "Bar", LoadTexture("karateka.png"));
-	sidekick2->owner = playerCharacter;
-	sidekick2->DisplayName = true;
-	sidekick2->speed = 190.0f;
-	GameObject::gameObjects.push_back(sidekick2);
+	GameObject::gameObjects.push_back(prefabs.Spawn("Foo", playerCharacter));
+	GameObject::gameObjects.push_back(prefabs.Spawn("Bar", playerCharacter));
 
 	//Ejemplo de dynamic_cast
 	for (GameObject* obj : GameObject::gameObjects)
@@ -201,11 +258,21 @@ int main()
 	*/
 	///UISystem::getInstance().createLabel("Bienbenido a mi juej0", 400, 400, 48);
 
-	while (!WindowShouldClose()) {
+	// al repetir se entra directo al juego
+	while (!replaying && !WindowShouldClose()) {
 		if (alpha < 1.0f) {
 			alpha += fadeSpeed;
 		}
 
+			if (settingsMenu.IsOpen()) {
+				settingsMenu.update();
+				BeginDrawing();
+				ClearBackground(DARKGRAY);
+				settingsMenu.draw();
+				EndDrawing();
+				continue;
+			}
+
 
 
 
@@ -237,6 +304,9 @@ int main()
 					}
 					break;  // Inicia el juego
 				}
+				if (selectedOption == SETTINGS) {
+					settingsMenu.Open();
+				}
 				if (selectedOption == EXIT) {
 					CloseWindow();
 					return 0;
@@ -261,32 +331,168 @@ int main()
 		return 1;
 	}
 
-		// game loop a 60 fps
-		while (!WindowShouldClose())		// run the loop untill the user presses ESCAPE or presses the Close button on the window
+		// lo que el hilo principal lee (teclas de depuracion y menus) y le pasa al tick
+		struct TickCommands
 		{
-			
-
-			if (IsKeyPressed(KEY_H)) health -= 10; // Ejemplo de cambio de estado
-			if (IsKeyPressed(KEY_E)) energy -= 5;
-			if (IsKeyPressed(KEY_L)) level++;
-			if (IsKeyPressed(KEY_SPACE)) {
-				Vector2 dir = { 1.0f, 0.0f };  // Disparo hacia la derecha
-				Projectile* newProjectile = new Projectile(playerCharacter->position, dir, 5.0f);
-				GameObject::gameObjects.push_back(newProjectile);
+			int saveSlot = -1;
+			int loadSlot = -1;
+			bool quickSave = false;
+			bool quickLoad = false;
+			bool rewind = false;
+			bool spawnEnemy = false;
+		} commands;
+
+		// el tick de simulacion: corre en su hilo mientras se dibuja el anterior
+		SimulationThread& simulation = SimulationThread::getInstance();
+		simulation.SetTick([&](RenderSnapshot& snapshot) {
+			const InputSystem& input = InputSystem::getInstance();
+			float deltaTime = input.GetDeltaTime();
+			playTime += deltaTime;
+
+			if (input.IsPressed(INPUT_DEBUG_DAMAGE)) health -= 10; // Ejemplo de cambio de estado
+			if (input.IsPressed(INPUT_DEBUG_ENERGY)) energy -= 5;
+			if (input.IsPressed(INPUT_DEBUG_LEVEL)) level++;
+			if (AutosaveService::getInstance().Tick(deltaTime)) pendingSaveSlot = AutosaveService::AUTOSAVE_SLOT;
+			if (commands.saveSlot >= 0) pendingSaveSlot = commands.saveSlot;
+
+			// solo se lee la partida completa del slot elegido
+			if (commands.loadSlot >= 0) {
+				WorldState world;
+				if (SaveManager::LoadWorld(commands.loadSlot, world)) {
+					SaveManager::ApplyWorld(world);
+					health = world.stats.health;
+					level = world.stats.level;
+					energy = world.stats.energy;
+					currentEra = world.stats.era;
+					playTime = world.stats.playTime;
+				}
+			}
+			// copias en memoria: F6 guarda, F7 reintenta, retroceso vuelve un segundo atras
+			if (commands.quickSave) quickSnapshot.Capture({ health, level, energy, currentEra, playTime }, input.GetTick());
+			PlayerStats restored;
+			if ((commands.quickLoad && quickSnapshot.Restore(0, restored)) ||
+				(commands.rewind && history.Restore(history.GetCount() - 1, restored))) {
+				health = restored.health;
+				level = restored.level;
+				energy = restored.energy;
+				currentEra = restored.era;
+				playTime = restored.playTime;
 			}
-			Button* spawnEnemyButton = new Button("Spawn Enemigo", 50, 500, 200, 50, DARKGRAY, [=]() {
+			if (input.IsPressed(INPUT_FIRE)) {
+				// Disparo hacia la derecha (direccion y velocidad del prefab, tope segun la calidad)
+				ProjectileSystem::getInstance().Fire(playerCharacter->position);
+			}
+			if (commands.spawnEnemy) {
 				//sideKick* newsideKck = new sideKick({ rand() % 800, rand() % 600 }, "sideKick", LoadTexture("Algo.png"));
-				Enemy* newEnemy = new Enemy({ (float)(rand() % 800), (float)(rand() % 600) }, "Enemy", playerCharacter);
+				GameRandom& random = GameRandom::getInstance();
+				GameObject* newEnemy = prefabs.Spawn("Enemy", { (float)random.Range(0, 799), (float)random.Range(0, 599) }, playerCharacter);
 				GameObject::gameObjects.push_back(newEnemy);
-				});
-			UISystem::getInstance().views.push_back(spawnEnemyButton);
-			UISystem::getInstance().UpdateHUD(health, level, energy);
+				AIScheduler::getInstance().Wake(newEnemy); // recien aparecido: actua aunque este lejos
+				Texture2D texture = newEnemy->GetTexture();
+				particles.Burst(spawnEmitter, { newEnemy->position.x + texture.width * 0.5f, newEnemy->position.y + texture.height * 0.5f });
+			}
 			//aqui van los update
 			//actualizar todos los gameobjects
-			for (GameObject* obj : GameObject::gameObjects)
+			//se itera una copia en la arena del frame: un update puede agregar
+			//o borrar objetos de la lista (ej. los proyectiles al salir de pantalla)
+			FrameVector<GameObject*> updateList(GameObject::gameObjects.begin(), GameObject::gameObjects.end());
+			for (GameObject* obj : updateList)
 			{
 				obj->update();
 			}
+			// rastro del jugador para la fila de sidekicks (antes de que la IA lo lea)
+			TrailSystem::getInstance().Update();
+			// IA por nivel de detalle: la vista es la pantalla, el foco el jugador
+			AIScheduler::getInstance().Update(deltaTime, { 0, 0, (float)GetScreenWidth(), (float)GetScreenHeight() }, playerCharacter->position);
+			// la horda se mueve junta: separacion y llegada para todos los enemigos cada tick
+			CrowdSystem::getInstance().Update(deltaTime);
+			TransformSystem::getInstance().Update(); //armas siguen a su dueno
+			// proyectiles: se mueven y se quitan al salir del nivel; los choques con enemigos van en un lote
+			ProjectileSystem& projectiles = ProjectileSystem::getInstance();
+			projectiles.Update(deltaTime, { 0, 0, (float)(Level::MAP_WIDTH * Level::TILE_SIZE), (float)(Level::MAP_HEIGHT * Level::TILE_SIZE) });
+			FrameVector<GameObject*> targets;
+			FrameVector<Rectangle> targetBoxes;
+			for (GameObject* obj : GameObject::gameObjects)
+			{
+				if (obj->GetType() != EntityType::Enemy) continue;
+				Texture2D texture = obj->GetTexture();
+				targets.push_back(obj);
+				targetBoxes.push_back({ obj->position.x, obj->position.y, (float)texture.width, (float)texture.height });
+			}
+			for (const ProjectileHit& hit : projectiles.Collide(targetBoxes.data(), (int)targetBoxes.size()))
+			{
+				GameObject*& target = targets[hit.box];
+				particles.Burst(impactEmitter, hit.position);
+				AIScheduler::getInstance().WakeAround(hit.position); // el impacto despierta a los de alrededor
+				if (!target) continue; // otro proyectil del lote ya lo derribo
+				GameObject::gameObjects.erase(std::remove(GameObject::gameObjects.begin(), GameObject::gameObjects.end(), target), GameObject::gameObjects.end());
+				delete target;
+				target = nullptr;
+			}
+			AnimationSystem::getInstance().Step(deltaTime); //todas las animaciones en un solo ciclo
+			particles.Update(deltaTime);
+			history.Capture({ health, level, energy, currentEra, playTime }, input.GetTick());
+
+			// lo que se ve de este tick: datos planos, sin punteros a objetos
+			snapshot.tick = input.GetTick();
+			snapshot.stats = { health, level, energy, currentEra, playTime };
+			for (GameObject* obj : GameObject::gameObjects)
+			{
+				obj->Emit(snapshot);
+			}
+			projectiles.Emit(snapshot);
+			particles.Emit(snapshot);
+			Level& currentLevel = Level::getInstance();
+			memcpy(snapshot.tileMap, currentLevel.tileMap, sizeof(snapshot.tileMap));
+			memcpy(snapshot.decorMap, currentLevel.decorMap, sizeof(snapshot.decorMap));
+			if (pendingSaveSlot >= 0) {
+				// copia del estado en el limite del tick; la miniatura se toma al dibujarla
+				snapshot.save = SaveManager::CaptureWorld(snapshot.stats);
+				snapshot.saveSlot = pendingSaveSlot;
+				pendingSaveSlot = -1;
+			}
+		});
+
+		// game loop a 60 fps
+		while (!WindowShouldClose())		// run the loop untill the user presses ESCAPE or presses the Close button on the window
+		{
+			double frameStart = GetTime(); // para medir el trabajo del frame sin la espera de vsync
+			FrameArena::NewFrame(); // reiniciar la memoria temporal del frame
+			InputSystem::NewTick(GetFrameTime()); // leer (o repetir) la entrada de este tick
+			const InputSystem& input = InputSystem::getInstance();
+			if (input.IsReplayFinished()) break;
+			if (replaying) {
+				double frameMs = GetFrameTime() * 1000.0;
+				replayFrameMs += frameMs;
+				if (frameMs > replayWorstMs) replayWorstMs = frameMs;
+			}
+
+			// las ordenes que cambian el mundo salen de InputSystem: se graban y se repiten
+			commands = TickCommands();
+			if (input.IsPressed(INPUT_QUICK_SAVE)) commands.saveSlot = 0; // guardado rapido en el slot 0
+			if (IsKeyPressed(KEY_F8)) loadMenu.Toggle(); // lista de partidas desde el indice
+			int chosenSlot = loadMenu.update();
+			if (chosenSlot >= 0) {
+				InputSystem::getInstance().QueueCommand(INPUT_COMMAND_LOAD_SLOT + chosenSlot);
+				loadMenu.Close();
+			}
+			commands.loadSlot = input.GetLoadSlot();
+			if (input.IsPressed(INPUT_QUICK_LOAD)) commands.loadSlot = 0; // carga rapida del slot 0
+			commands.quickSave = input.IsPressed(INPUT_SNAPSHOT_SAVE);
+			commands.quickLoad = input.IsPressed(INPUT_SNAPSHOT_LOAD);
+			commands.rewind = input.IsPressed(INPUT_REWIND);
+			//boton en modo inmediato: se declara cada frame pero su estado se reutiliza
+			//(antes se hacia new Button cada frame y la lista de views crecia sin limite)
+			if (UISystem::ImButton("spawnEnemy", "Spawn Enemigo", 50, 500, 200, 50, DARKGRAY))
+				InputSystem::getInstance().QueueCommand(INPUT_COMMAND_SPAWN_ENEMY);
+			commands.spawnEnemy = input.IsCommand(INPUT_COMMAND_SPAWN_ENEMY);
+
+			// desde aqui hasta Wait el estado del juego es del hilo de simulacion
+			simulation.Kick();
+
+			// se dibuja la copia del tick anterior
+			RenderSnapshot& view = simulation.GetFront();
+			UISystem::getInstance().UpdateHUD(view.stats.health, view.stats.level, view.stats.energy);
 			UISystem::Update(); //actualizar el sistema de UI
 
 			// despues de beginDrawing consideraremos los draw
@@ -294,29 +500,77 @@ int main()
 
 			// Setup the back buffer for drawing (clear color and depth buffers)
 			ClearBackground(SKYBLUE);
-			Level::getInstance().draw();
+			// todo se encola por capa y profundidad y se dibuja ordenado en Flush
+			RenderQueue& renderQueue = RenderQueue::getInstance();
+			Level& currentLevel = Level::getInstance();
+			renderQueue.Submit(LAYER_GROUND, 0.0f, currentLevel.GetTilesetId(),
+				[](void* snapshot) { Level::getInstance().drawGround(static_cast<RenderSnapshot*>(snapshot)->tileMap); }, &view);
+			renderQueue.Submit(LAYER_DECORATION, 0.0f, currentLevel.GetTilesetId(),
+				[](void* snapshot) { Level::getInstance().drawDecoration(static_cast<RenderSnapshot*>(snapshot)->decorMap); }, &view);
 			//DrawRectangle(10, 10, 100, 100, RED); // Si esto aparece, Raylib est dibujando bien.
 			//DrawRectangle(10, 10, 100, 20, RED); // Test visual
 			
 			//DrawTexture(hudBar, 10, 10, WHITE); // draw the health bar frame
-			Rectangle sourceRec = { 0, 0, hudBar.width, hudBar.height };  // Regin completa de la imagen
-			Rectangle destRec = { 10, 10, hudBar.width * 4, hudBar.height * 4 }; // Escalado x4
-			Vector2 origin = { 0, 0 };  // Punto de origen
-
-			DrawTexturePro(hudBar, sourceRec, destRec, origin, 0.0f, WHITE); // draw the health bar frame with source and destination rectangles
+			renderQueue.Submit(LAYER_UI, 0.0f, hudBar.id, [](void* texture) {
+				Texture2D& bar = *static_cast<Texture2D*>(texture);
+				Rectangle sourceRec = { 0, 0, (float)bar.width, (float)bar.height };  // Regin completa de la imagen
+				Rectangle destRec = { 10, 10, bar.width * 4.0f, bar.height * 4.0f }; // Escalado x4
+				Vector2 origin = { 0, 0 };  // Punto de origen
+
+				DrawTexturePro(bar, sourceRec, destRec, origin, 0.0f, WHITE); // draw the health bar frame with source and destination rectangles
+			}, &hudBar);
 			
 			// draw some text using the default font
 			
-			for (GameObject* obj : GameObject::gameObjects)
-			{
-				obj->draw();
+			view.Submit(renderQueue);
+			renderQueue.Flush();
+			if (view.prompt) DrawText(view.prompt, 20, GetScreenHeight() - 40, 20, YELLOW);
+
+			if (view.saveSlot >= 0) {
+				// el mundo de esta copia ya esta dibujado: se le agrega la miniatura
+				WorldState world = std::move(view.save);
+				SaveIndex::CaptureThumbnail(world.thumbnail);
+#ifdef DEBUG
+				// copia legible para depurar; no hace falta en este frame
+				TaskScheduler::getInstance().Submit([slot = view.saveSlot, copy = world]() {
+					SaveManager::ExportJson(slot, copy);
+					return true;
+				}, TASK_LOW, "exportJson");
+#endif
+				// en el hilo principal solo se copia el estado; se escribe en segundo plano
+				AutosaveService::getInstance().Submit(view.saveSlot, std::move(world));
+				view.saveSlot = -1;
 			}
 
 			UISystem::Draw();
+			loadMenu.draw();
+			simulation.Wait(); // la copia nueva se dibuja el siguiente frame
+			// trabajo largo partido en pasos, hasta el presupuesto del frame; despues
+			// de Wait porque las tareas pueden tocar el mundo
+			TaskScheduler::getInstance().RunFrame();
+			QualityGovernor::getInstance().AddFrame((float)((GetTime() - frameStart) * 1000.0));
 			// end the frame and get ready for the next one  (display frame, poll input, etc...)
 			EndDrawing();
 		}
+		simulation.Stop();
 		
+		if (replaying) {
+			uint32_t ticks = InputSystem::getInstance().GetTick();
+			std::cout << "Repeticion: " << ticks << " ticks, media " << replayFrameMs / (ticks ? ticks : 1)
+				<< " ms, peor " << replayWorstMs << " ms" << std::endl;
+			AIScheduler& ai = AIScheduler::getInstance();
+			std::cout << "IA: " << ai.GetAgentCount() << " agentes, cerca " << ai.GetTierCount(AI_TIER_NEAR)
+				<< ", medio " << ai.GetTierCount(AI_TIER_MID) << ", lejos " << ai.GetTierCount(AI_TIER_FAR)
+				<< ", dormidos " << ai.GetTierCount(AI_TIER_ASLEEP) << std::endl;
+		}
+		// lo que quede en el planificador se termina antes de cerrar
+		TaskScheduler::getInstance().Flush();
+		// escribe la grabacion si habia una
+		InputSystem::getInstance().Stop();
+		// hilos de la horda
+		CrowdSystem::getInstance().Shutdown();
+		// terminar de escribir cualquier guardado pendiente
+		AutosaveService::getInstance().Shutdown();
 		// destroy the window and cleanup the OpenGL context
 		CloseWindow();
 		return 0;
@@ -5,23 +5,37 @@
     using namespace Quetz_LabEDC;
 
 
-	void sideKick::update()
+	void sideKick::tick(float deltaTime)
 	{
-		//moverse hacia el jugador hasta cierta distancia
-
-
-		if (owner != nullptr)
+		//seguir el camino del owner: un lugar fijo de la fila sobre su rastro
+		TrailSystem& trails = TrailSystem::getInstance();
+		if (owner != leader)
 		{
-			Vector2 dir = Vector2Subtract(owner->position, position);
-
-			float distance = Vector2Length(dir);
+			trails.Leave(trail, trailSlot);
+			trailSlot = owner ? trails.Join(owner, this, trail) : -1;
+			leader = owner;
+			inFormation = false;
+		}
 
-			if (distance > 50)
-			{
-				dir = Vector2Normalize(dir);
-				position = Vector2Add(position, Vector2Scale(dir, speed * GetFrameTime()));
-			}
+		Vector2 target;
+		if (owner == nullptr || !trails.GetSlotPoint(trail, trailSlot, target))
+		{
+			//el owner aun no deja suficiente camino: esperar donde esta
+			inFormation = false;
+			return;
 		}
 
+		float distance = Vector2Distance(target, position);
+		if (inFormation && distance > trails.followGap)
+			inFormation = false; //se quedo atras (rastro nuevo): alcanzar otra vez
+		float step = speed * deltaTime;
+		if (inFormation || distance <= step)
+		{
+			position = target;
+			inFormation = true;
+		}
+		else
+		{
+			position = Vector2MoveTowards(position, target, step);
+		}
 	}
-